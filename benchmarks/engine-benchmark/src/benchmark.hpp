@@ -0,0 +1,163 @@
+#pragma once
+#include <vinter/engine.hpp>
+#include <vinter/transform_batch.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <SDL3/SDL.h> // Scripted input is pushed through SDL's event queue, like real device input.
+
+/**
+ * A deterministic workload for the engine loop: a field of bouncing sprites steered by scripted input.
+ *
+ * The simulation advances by a constant step every frame, independent of the measured frame delta,
+ * so every run does the same work.
+ */
+class Benchmark : public vn::Engine {
+public:
+    struct Options {
+        std::uint64_t frames { 2000 };
+        std::size_t sprites { 10000 };
+        bool scripted_input { true }; // Disabled when input is replayed from a recording.
+        bool batched { false };       // Draws the sprites as one TransformBatch per layer instead of one by one.
+    };
+
+    Benchmark(const vn::ProjectSettings& project_settings, const Options& options)
+        : Engine(project_settings)
+        , m_options(options) {
+    }
+
+protected:
+    void load() override {
+        m_move = input->bind("move", vn::Keyboard::Key::Right);
+        m_jump = input->bind("jump", vn::Keyboard::Key::Space);
+        m_zoom = input->bind("zoom", vn::Mouse::Wheel::Up);
+
+        camera->position = glm::vec2 { ArenaWidth, ArenaHeight } * 0.5f;
+
+        m_bodies.resize(m_options.sprites);
+        std::uint32_t seed = 1;
+        for (Body& body : m_bodies) {
+            body.position = { next_random(seed) % ArenaWidth, next_random(seed) % ArenaHeight };
+            body.velocity = { static_cast<float>(next_random(seed) % 200) - 100.f, static_cast<float>(next_random(seed) % 200) - 100.f };
+        }
+    }
+
+    void poll_events() override {
+        if (m_options.scripted_input) push_scripted_input();
+    }
+
+    void update(float delta) override {
+        constexpr float step = 1.f / 60.f;
+
+        const float push = input->get_action_strength(m_move) * 50.f;
+        const float kick = input->is_action_just_pressed(m_jump) ? -200.f : 0.f;
+        m_size = input->is_action_just_pressed(m_zoom) ? (m_size == 4.f ? 8.f : 4.f) : m_size;
+
+        jobs->parallel_for(m_bodies.size(), [&](const std::size_t i) {
+            Body& body = m_bodies[i];
+            body.velocity.x += push * step;
+            body.velocity.y += kick;
+            body.position += body.velocity * step;
+
+            if (body.position.x < 0.f || body.position.x > ArenaWidth)  body.velocity.x = -body.velocity.x;
+            if (body.position.y < 0.f || body.position.y > ArenaHeight) body.velocity.y = -body.velocity.y;
+        });
+
+        if (++m_frame >= m_options.frames) {
+            quit();
+        }
+    }
+
+    void render() override {
+        if (m_options.batched) {
+            render_batched();
+            return;
+        }
+
+        for (std::size_t i = 0; i < m_bodies.size(); ++i) {
+            renderer->draw_sprite({
+                .position = m_bodies[i].position,
+                .size = { m_size, m_size },
+                .tint = (i % 2 == 0) ? vn::colors::Lime : vn::colors::DarkGreen,
+                .layer = static_cast<std::int32_t>(i % 4),
+            });
+        }
+    }
+
+private:
+    static constexpr std::size_t LayerCount { 4 };
+
+    // Same scene as the unbatched path: body i is drawn in layer i % 4, in lime on even layers.
+    void render_batched() {
+        for (vn::TransformBatch& batch : m_batches) batch.clear();
+        for (std::size_t i = 0; i < m_bodies.size(); ++i) {
+            m_batches[i % LayerCount].add(m_bodies[i].position);
+        }
+
+        for (std::size_t layer = 0; layer < LayerCount; ++layer) {
+            renderer->draw_sprites({
+                .size = { m_size, m_size },
+                .tint = (layer % 2 == 0) ? vn::colors::Lime : vn::colors::DarkGreen,
+                .layer = static_cast<std::int32_t>(layer),
+            }, m_batches[layer]);
+        }
+    }
+
+    struct Body {
+        glm::vec2 position;
+        glm::vec2 velocity;
+    };
+
+    static constexpr std::uint32_t ArenaWidth { 1280 };
+    static constexpr std::uint32_t ArenaHeight { 720 };
+
+    static std::uint32_t next_random(std::uint32_t& state) {
+        // xorshift32, so the scene is identical on every platform.
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    void push_key(const SDL_Scancode scancode, const bool down) const {
+        SDL_Event event {};
+        event.type = down ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+        event.key.scancode = scancode;
+        event.key.down = down;
+        event.key.timestamp = SDL_GetTicksNS();
+        SDL_PushEvent(&event);
+    }
+
+    /**
+     * Holds a key for a few frames, taps another within a single frame and scrolls periodically.
+     * Pushed events are picked up by the next frame's event loop.
+     */
+    void push_scripted_input() const {
+        if (m_frame % 30 == 0) push_key(SDL_SCANCODE_RIGHT, true);
+        if (m_frame % 30 == 5) push_key(SDL_SCANCODE_RIGHT, false);
+
+        if (m_frame % 45 == 0) {
+            push_key(SDL_SCANCODE_SPACE, true);
+            push_key(SDL_SCANCODE_SPACE, false);
+        }
+
+        if (m_frame % 20 == 0) {
+            SDL_Event event {};
+            event.type = SDL_EVENT_MOUSE_WHEEL;
+            event.wheel.y = 1.f;
+            event.wheel.timestamp = SDL_GetTicksNS();
+            SDL_PushEvent(&event);
+        }
+    }
+
+    Options m_options;
+    std::uint64_t m_frame { 0 };
+    float m_size { 4.f };
+    std::vector<Body> m_bodies;
+    std::array<vn::TransformBatch, LayerCount> m_batches;
+
+    vn::ActionHandle m_move;
+    vn::ActionHandle m_jump;
+    vn::ActionHandle m_zoom;
+};
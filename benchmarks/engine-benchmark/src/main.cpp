@@ -0,0 +1,112 @@
+#include "benchmark.hpp"
+#include "report.hpp"
+
+#include <charconv>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+
+#if defined(VINTER_PROFILER_DISABLED)
+    #error "The engine benchmark reads phase timings from profiler zones, build with VINTER_ENABLE_PROFILER=ON."
+#endif
+
+namespace {
+    void print_usage() {
+        std::cerr <<
+            "Usage: engine-benchmark [options]\n"
+            "  --frames N       Frames to measure (default 2000).\n"
+            "  --warmup N       Frames to run before measuring (default 120).\n"
+            "  --sprites N      Sprites in the scene (default 10000).\n"
+            "  --threaded N     Submit frames on a render thread when 1 (default 0).\n"
+            "  --batched N      Draw sprites through transform batches when 1 (default 0).\n"
+            "  --replay PATH    Replay a recorded input file instead of the scripted input.\n"
+            "  --record PATH    Record the input of this run.\n"
+            "  --output PATH    Write the JSON report to a file instead of stdout.\n";
+    }
+
+    template<typename T>
+    bool parse_number(const std::string_view text, T& value) {
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return error == std::errc {} && end == text.data() + text.size();
+    }
+}
+
+int main(const int argc, char** argv) {
+    // The engine's phases: Frame, Events, Assets, Devices, FixedUpdate, Update, Systems, Render and Present.
+    // Frames also record a zone per system and physics step, so this is only an upper bound, the report
+    // checks that no frame was overwritten in the profiler's ring buffer.
+    constexpr std::uint64_t zones_per_frame { 9 };
+    constexpr std::uint64_t max_total_frames { vn::Profiler::ZonesPerThread / zones_per_frame };
+
+    Benchmark::Options options;
+    std::uint64_t warmup = 120;
+    unsigned threaded = 0;
+    unsigned batched = 0;
+    vn::ProjectSettings project_settings {
+        .window = {
+            .virtual_size = { 1280, 720 }, // The whole arena, so that no sprite is culled.
+            .headless = true,
+        },
+    };
+    std::string output_path;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view argument { argv[i] };
+        const bool has_value = i + 1 < argc;
+        const std::string_view value = has_value ? argv[i + 1] : std::string_view {};
+
+        bool valid = has_value;
+        if (argument == "--frames")       valid = valid && parse_number(value, options.frames);
+        else if (argument == "--warmup")  valid = valid && parse_number(value, warmup);
+        else if (argument == "--sprites") valid = valid && parse_number(value, options.sprites);
+        else if (argument == "--threaded") valid = valid && parse_number(value, threaded) && threaded <= 1;
+        else if (argument == "--batched") valid = valid && parse_number(value, batched) && batched <= 1;
+        else if (argument == "--replay")  project_settings.input.replay_path = value;
+        else if (argument == "--record")  project_settings.input.record_path = value;
+        else if (argument == "--output")  output_path = value;
+        else valid = false;
+
+        if (!valid) {
+            print_usage();
+            return 2;
+        }
+        ++i;
+    }
+
+    if (warmup + options.frames > max_total_frames) {
+        std::cerr << "At most " << max_total_frames << " frames (including warmup) fit in the profiler buffer.\n";
+        return 2;
+    }
+
+    options.frames += warmup;
+    options.scripted_input = project_settings.input.replay_path.empty();
+    project_settings.renderer.threaded = threaded == 1;
+    options.batched = batched == 1;
+
+    vn::Profiler::set_enabled(true);
+    {
+        Benchmark benchmark(project_settings, options);
+        benchmark.run();
+    }
+    vn::Profiler::set_enabled(false);
+
+    Report report = build_report(vn::Profiler::snapshot(), warmup);
+    report.sprites = options.sprites;
+
+    if (report.warmup + report.frames < options.frames) {
+        std::cerr << "The profiler buffer wrapped and dropped the oldest frames, measure fewer frames.\n";
+        return 1;
+    }
+
+    if (output_path.empty()) {
+        write_json(std::cout, report);
+    } else {
+        std::ofstream file(output_path);
+        if (!file) {
+            std::cerr << "Failed to open " << output_path << " for writing.\n";
+            return 1;
+        }
+        write_json(file, report);
+    }
+    return 0;
+}
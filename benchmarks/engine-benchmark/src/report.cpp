@@ -0,0 +1,95 @@
+#include "report.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <unordered_map>
+
+namespace {
+    double percentile(const std::vector<double>& sorted, const double fraction) {
+        // Nearest-rank percentile.
+        const auto rank = static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+        return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+    }
+}
+
+Report build_report(const std::vector<vn::Profiler::ZoneRecord>& zones, const std::uint64_t warmup) {
+    if (zones.empty()) return { .warmup = warmup };
+
+    // Only consider the thread that runs the loop, which records the "Frame" zones.
+    std::uint32_t main_thread = zones.front().thread_id;
+    for (const auto& zone : zones) {
+        if (std::strcmp(zone.name, "Frame") == 0) {
+            main_thread = zone.thread_id;
+            break;
+        }
+    }
+
+    // Zones are ordered by start time, so every zone belongs to the latest "Frame" zone started before it.
+    std::unordered_map<std::string, std::vector<double>> per_frame_us;
+    std::unordered_map<std::string, double> frame_totals_ns;
+    std::uint64_t frame_index = 0;
+    bool in_frame = false;
+
+    const auto flush_frame = [&] {
+        if (in_frame && frame_index > warmup) {
+            for (auto& [name, total_ns] : frame_totals_ns) {
+                per_frame_us[name].push_back(total_ns / 1000.0);
+            }
+        }
+        frame_totals_ns.clear();
+    };
+
+    for (const auto& zone : zones) {
+        if (zone.thread_id != main_thread) continue;
+
+        if (std::strcmp(zone.name, "Frame") == 0) {
+            flush_frame();
+            ++frame_index;
+            in_frame = true;
+        }
+        if (in_frame) {
+            frame_totals_ns[zone.name] += static_cast<double>(zone.end_ns - zone.start_ns);
+        }
+    }
+    flush_frame();
+
+    Report report;
+    report.warmup = warmup;
+    report.frames = frame_index > warmup ? frame_index - warmup : 0;
+
+    for (auto& [name, samples] : per_frame_us) {
+        std::sort(samples.begin(), samples.end());
+        report.phases[name] = {
+            .samples = samples.size(),
+            .p50_us = percentile(samples, 0.50),
+            .p99_us = percentile(samples, 0.99),
+            .max_us = samples.back(),
+            .mean_us = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size()),
+        };
+    }
+    return report;
+}
+
+void write_json(std::ostream& out, const Report& report) {
+    out << "{\"frames\":" << report.frames
+        << ",\"warmup\":" << report.warmup
+        << ",\"sprites\":" << report.sprites
+        << ",\"unit\":\"us\",\"phases\":{";
+
+    bool first = true;
+    for (const auto& [name, stats] : report.phases) {
+        if (!first) out << ',';
+        first = false;
+
+        out << '"' << name << "\":{"
+            << "\"samples\":" << stats.samples
+            << ",\"p50\":" << stats.p50_us
+            << ",\"p99\":" << stats.p99_us
+            << ",\"max\":" << stats.max_us
+            << ",\"mean\":" << stats.mean_us
+            << '}';
+    }
+    out << "}}\n";
+}
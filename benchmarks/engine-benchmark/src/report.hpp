@@ -0,0 +1,36 @@
+#pragma once
+#include <vinter/profiler.hpp>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Per-phase frame time statistics, gathered from the engine's profiler zones.
+ */
+struct PhaseStats {
+    std::uint64_t samples { 0 };
+    double p50_us { 0.0 };
+    double p99_us { 0.0 };
+    double max_us { 0.0 };
+    double mean_us { 0.0 };
+};
+
+struct Report {
+    std::uint64_t frames { 0 };  // Frames measured, after warmup.
+    std::uint64_t warmup { 0 };
+    std::size_t sprites { 0 };
+    std::map<std::string, PhaseStats> phases;
+};
+
+/**
+ * Groups the zones of the main thread by frame (the "Frame" zone enclosing them) and computes,
+ * for every zone name, the percentiles of its total duration per frame.
+ */
+Report build_report(const std::vector<vn::Profiler::ZoneRecord>& zones, std::uint64_t warmup);
+
+/**
+ * Writes the report as a single JSON object, so that runs can be compared by scripts.
+ */
+void write_json(std::ostream& out, const Report& report);
@@ -1,6 +1,9 @@
 #pragma once
 #include <vinter/engine.hpp>
-#include <iostream>
+#include <vinter/tilemap.hpp>
+#include <array>
+#include <memory>
+#include <string>
 
 class Bomberman : public vn::Engine {
 public:
@@ -17,28 +20,66 @@ protected:
         input->bind("set_bg_color_blue", vn::Gamepad::Button::East);
         input->bind("set_bg_color_blue", vn::Gamepad::Axis::LeftStickLeft, 1);
 
-        input->bind("quit", vn::Keyboard::Key::Esc);
+        m_quit = input->bind("quit", vn::Keyboard::Key::Esc);
+
+        m_set_bg_color_red = input->get_action("set_bg_color_red");
+        m_set_bg_color_blue = input->get_action("set_bg_color_blue");
+
+        // One pixel per tile, stretched to the tile size: floor, dark floor, wall.
+        const std::array<vn::Color, 3> tile_colors { vn::colors::Lime, vn::colors::DarkGreen, vn::colors::DarkGray };
+        const vn::Texture tiles = renderer->create_texture(3, 1, tile_colors.data());
+
+        // Checkerboard floor with solid walls along the border and every other inner tile.
+        const vn::Tileset tileset { .texture = tiles, .tile_size = { 1, 1 } };
+        m_level = std::make_unique<vn::Tilemap>(LevelWidth, LevelHeight, tileset, glm::vec2 { TileSize });
+        for (int y = 0; y < LevelHeight; ++y) {
+            for (int x = 0; x < LevelWidth; ++x) {
+                const bool border = x == 0 || y == 0 || x == LevelWidth - 1 || y == LevelHeight - 1;
+                const bool pillar = x % 2 == 0 && y % 2 == 0;
+
+                m_level->set_tile(x, y, (border || pillar) ? Wall : ((x + y) % 2 == 0 ? Floor : DarkFloor));
+            }
+        }
+
+        camera->position = glm::vec2 { LevelWidth, LevelHeight } * TileSize * 0.5f;
     }
 
     void update(float delta) override {
-        if (input->is_action_just_pressed("set_bg_color_red")) {
+        if (input->is_action_just_pressed(m_set_bg_color_red)) {
             m_background_color = vn::colors::Red;
         }
-        else if (input->is_action_just_pressed("set_bg_color_blue")) {
+        else if (input->is_action_just_pressed(m_set_bg_color_blue)) {
             m_background_color = vn::colors::Blue;
         }
 
-        else if (input->is_action_just_pressed("quit")) {
+        else if (input->is_action_just_pressed(m_quit)) {
             quit();
         }
-        // // Check action strengths.
-        std::cout << input->get_action_strength("set_bg_color_blue") << std::endl;
+        // Check action strengths, without formatting the message in builds that strip debug messages.
+        if constexpr (vn::Logger::DebugEnabled) {
+            vn::Logger::debug(std::to_string(input->get_action_strength(m_set_bg_color_blue)));
+        }
     }
 
     void render() override {
         renderer->set_clear_color(m_background_color);
+
+        m_level->draw(*renderer, renderer->get_view_rect());
     }
 
 private:
+    static constexpr int LevelWidth { 40 };
+    static constexpr int LevelHeight { 22 };
+    static constexpr float TileSize { 16.f }; // The level fills the 640x360 virtual resolution.
+
+    static constexpr vn::TileID Floor { 1 };
+    static constexpr vn::TileID DarkFloor { 2 };
+    static constexpr vn::TileID Wall { 3 };
+
     vn::Color m_background_color { vn::colors::DarkBlue };
+    std::unique_ptr<vn::Tilemap> m_level;
+
+    vn::ActionHandle m_set_bg_color_red;
+    vn::ActionHandle m_set_bg_color_blue;
+    vn::ActionHandle m_quit;
 };
@@ -6,7 +6,10 @@ int main() {
             .flags = {
                 .resizeable = true,
             }
-        }
+        },
+        .logger = {
+            .async = true,
+        },
     };
     Bomberman bomberman(project_settings);
     bomberman.run();
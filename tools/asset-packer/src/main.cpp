@@ -0,0 +1,61 @@
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "vinter/assets/archive_writer.hpp"
+
+namespace {
+    void print_usage() {
+        std::cerr <<
+            "Usage: asset-packer <output> <input directory>...\n"
+            "  Packs every file under the input directories into one archive for vn::AssetArchive,\n"
+            "  each looked up by its path relative to its input directory, with '/' separators.\n";
+    }
+
+    /**
+     * Adds every regular file under `root`, in path order so that packing the same tree gives the same archive.
+     */
+    bool add_directory(vn::ArchiveWriter& writer, const std::filesystem::path& root) {
+        std::error_code error;
+        if (!std::filesystem::is_directory(root, error)) {
+            std::cerr << "Not a directory: " << root.string() << '\n';
+            return false;
+        }
+
+        std::vector<std::filesystem::path> files;
+        for (auto it = std::filesystem::recursive_directory_iterator { root, error };
+             !error && it != std::filesystem::recursive_directory_iterator {}; it.increment(error)) {
+            if (it->is_regular_file(error)) files.push_back(it->path());
+        }
+        if (error) {
+            std::cerr << "Failed to list " << root.string() << ": " << error.message() << '\n';
+            return false;
+        }
+
+        std::ranges::sort(files);
+        for (const std::filesystem::path& file : files) {
+            writer.add_file(file.lexically_relative(root).generic_string(), file.string());
+        }
+        return true;
+    }
+}
+
+int main(const int argc, char** argv) {
+    if (argc < 3) {
+        print_usage();
+        return 1;
+    }
+
+    vn::ArchiveWriter writer;
+    for (int i = 2; i < argc; ++i) {
+        if (!add_directory(writer, argv[i])) return 1;
+    }
+
+    if (!writer.write(argv[1])) return 1;
+
+    std::cout << "Packed " << writer.get_entry_count() << " files into " << argv[1] << '\n';
+    return 0;
+}
@@ -0,0 +1,11 @@
+# Converts a binary file into a C++ header declaring its bytes as an inline constexpr array.
+# Usage: cmake -DINPUT=<file> -DOUTPUT=<header> -DSYMBOL=<name> -P EmbedFile.cmake
+file(READ "${INPUT}" contents HEX)
+string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," bytes "${contents}")
+
+file(WRITE "${OUTPUT}"
+    "#pragma once\n\n"
+    "#include <cstdint>\n\n"
+    "// Generated from ${INPUT}, do not edit.\n"
+    "inline constexpr std::uint8_t ${SYMBOL}[] = { ${bytes} };\n"
+)
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vn {
+    /**
+     * Packs files into a single archive for AssetArchive.
+     *
+     * Files added from disk are only read while the archive is written, so packing large asset trees needs
+     * little memory. Every entry starts on an aligned offset.
+     *
+     * Typical usage:
+     * @code{.cpp}
+     * ArchiveWriter writer;
+     * writer.add_file("textures/player.png", "assets/textures/player.png");
+     * writer.add("config/difficulty.json", difficulty_bytes);
+     * writer.write("game.vpak");
+     * @endcode
+     */
+    class ArchiveWriter {
+    public:
+        /**
+         * Adds a file to be read from `source_path` when the archive is written.
+         *
+         * @param path The path to look the file up by, `\` separators are converted to `/`.
+         * @param source_path The file to pack.
+         */
+        void add_file(std::string_view path, std::string_view source_path);
+
+        /**
+         * Adds a copy of in-memory data.
+         */
+        void add(std::string_view path, std::span<const std::byte> data);
+
+        [[nodiscard]] std::size_t get_entry_count() const noexcept { return m_entries.size(); }
+
+        /**
+         * Writes every added entry to an archive file. Entries added twice under the same path keep the last one.
+         * The archive is written to a temporary file renamed over `output_path` once complete, so that a failed
+         * write leaves any previous archive untouched.
+         *
+         * @return `true` if the archive was written, `false` otherwise, with the error logged.
+         */
+        bool write(std::string_view output_path) const;
+
+    private:
+        struct Entry {
+            std::string path;
+            std::string source_path;        // Empty for in-memory entries.
+            std::vector<std::byte> data;
+        };
+
+        std::vector<Entry> m_entries;
+
+        static std::string normalize_path(std::string_view path);
+    };
+} // vn
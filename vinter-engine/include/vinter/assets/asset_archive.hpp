@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string_view>
+
+namespace vn {
+    /**
+     * Serves the files packed into an archive by ArchiveWriter (see the asset-packer tool), straight from a
+     * read-only memory map of the archive.
+     *
+     * Opening maps the whole archive with a single file open, and looking a file up is a binary search
+     * over its table of contents. The returned bytes point into the map: nothing is read or copied until
+     * they are touched, and the OS pages them in on demand.
+     *
+     * Typical usage:
+     * @code{.cpp}
+     * const Texture player = renderer->load_texture(archive->find("textures/player.png"));
+     * const FontHandle hud_font = text->load_font(archive->find("fonts/hud.ttf"), 18.f);
+     * @endcode
+     *
+     * @note Paths are relative to the packed directory, with `/` separators. Spans returned by `find` are
+     * valid until the archive is closed, so the archive must outlive fonts loaded from it.
+     */
+    class AssetArchive {
+    public:
+        AssetArchive();
+        ~AssetArchive();
+
+        AssetArchive(const AssetArchive&) = delete;
+        AssetArchive& operator=(const AssetArchive&) = delete;
+
+        /**
+         * Maps an archive, closing the one currently open, if any.
+         *
+         * @return `true` if the archive was opened, `false` otherwise, with the error logged.
+         */
+        bool open(std::string_view path);
+        void close();
+
+        [[nodiscard]] bool is_open() const noexcept;
+
+        /**
+         * Returns the contents of a packed file, or an empty span if the archive does not contain it.
+         */
+        [[nodiscard]] std::span<const std::byte> find(std::string_view path) const noexcept;
+        [[nodiscard]] bool contains(std::string_view path) const noexcept;
+
+        [[nodiscard]] std::size_t get_entry_count() const noexcept;
+
+        /**
+         * Returns the path of the packed file at `index`, in no particular order.
+         */
+        [[nodiscard]] std::string_view get_entry_path(std::size_t index) const;
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+    };
+} // vn
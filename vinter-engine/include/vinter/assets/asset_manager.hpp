@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "vinter/texture.hpp"
+
+namespace vn {
+    struct AssetSettings;
+    class AssetArchive;
+    class Renderer;
+
+    /**
+     * A reference-counted handle to a texture loaded by the AssetManager.
+     *
+     * The generation tells a handle apart from later assets that reuse its slot once it is released.
+     */
+    struct TextureAsset {
+        static constexpr std::uint32_t InvalidIndex { 0xFFFFFFFF };
+
+        std::uint32_t index { InvalidIndex };
+        std::uint32_t generation { 0 };
+
+        [[nodiscard]] constexpr bool is_valid() const noexcept { return index != InvalidIndex; }
+        constexpr bool operator==(const TextureAsset&) const = default;
+    };
+
+    enum class AssetState {
+        Unloaded,   // Never loaded, or released.
+        Loading,    // Queued, being decoded, or decoded and waiting for its upload.
+        Ready,      // Also while being reloaded, with the previous texture.
+        Failed,
+    };
+
+    /**
+     * Loads textures in the background, so that loading a level never stalls the frame.
+     *
+     * Requesting a texture returns its handle immediately. Images are read and decoded on dedicated loader
+     * threads, from the engine's AssetArchive when it contains the path, or from disk otherwise. Decoded
+     * images are uploaded on the main thread at the start of the next frames, only as many per frame as
+     * fit `AssetSettings::upload_budget`, so that a burst of loads is spread over frames instead of
+     * stalling one. With a threaded renderer whose backend supports concurrent uploads, the uploads are staged
+     * while the render thread submits the previous frame, and go to the GPU with the next one it submits;
+     * otherwise, like destroying released textures, they first wait for the frame in flight.
+     *
+     * Requesting a path that is already loaded or loading returns the same handle with one more reference.
+     * Reloading a texture keeps its handle, which switches to the new texture once it is uploaded.
+     * Every request must be balanced by a `release`; a texture is destroyed at the start of the frame after
+     * its last reference is released, and abandoned when released while still loading.
+     *
+     * Typical usage:
+     * @code{.cpp}
+     * void load() override {
+     *     m_player = assets->load_texture("textures/player.png");
+     * }
+     *
+     * void render() override {
+     *     // Not drawn until it is ready, a few frames later.
+     *     if (const Texture texture = assets->get_texture(m_player); texture.is_valid()) {
+     *         renderer->draw_sprite({ .texture = texture, .position = m_position });
+     *     }
+     * }
+     * @endcode
+     *
+     * @note Handles are only meant for the main thread. The archive must not be reopened while textures are loading.
+     */
+    class AssetManager {
+        friend class Engine;
+
+    public:
+        AssetManager(Renderer& renderer, const AssetArchive& archive, const AssetSettings& asset_settings);
+        ~AssetManager();
+
+        AssetManager(const AssetManager&) = delete;
+        AssetManager& operator=(const AssetManager&) = delete;
+
+        /**
+         * Requests an image file (BMP or PNG), or adds a reference to the already requested one.
+         *
+         * @return The texture's handle, valid at once even though the texture is not ready yet.
+         */
+        [[nodiscard]] TextureAsset load_texture(std::string_view path);
+
+        /**
+         * Imports the texture requested as `path` again from the file at `source_path`, in the background.
+         * Its handle keeps returning the current texture until the new one is uploaded, between two frames.
+         * Only the latest request counts: the results of earlier loads and reloads of the path are discarded.
+         *
+         * @return `true` if a texture was requested as `path`, `false` otherwise.
+         */
+        bool reload(std::string_view path, std::string_view source_path);
+
+        /**
+         * Adds a reference to a loaded or loading texture.
+         */
+        void retain(TextureAsset asset);
+
+        /**
+         * Removes a reference, unloading the texture when it was the last one.
+         */
+        void release(TextureAsset asset);
+
+        [[nodiscard]] AssetState get_state(TextureAsset asset) const;
+
+        /**
+         * Returns the texture once it is ready, or an invalid texture otherwise.
+         */
+        [[nodiscard]] Texture get_texture(TextureAsset asset) const;
+
+        /**
+         * Returns the number of requested textures that are not ready yet, for loading screens and
+         * level transitions.
+         */
+        [[nodiscard]] std::size_t get_pending_count() const noexcept;
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+
+        /**
+         * Uploads decoded images within the frame's budget, and destroys the textures released since the last frame.
+         */
+        void update();
+    };
+} // vn
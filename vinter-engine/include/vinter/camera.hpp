@@ -0,0 +1,80 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include "vinter/rect.hpp"
+
+namespace vn {
+    struct WindowSettings;
+
+    /**
+     * A 2D view into the world, rendered at a fixed virtual resolution.
+     *
+     * The virtual resolution (`WindowSettings::virtual_size`) is scaled to fit the window, by whole
+     * multiples when `WindowSettings::integer_scaling` is enabled, and centered with letterboxing
+     * around it. The camera shows `virtual_size / zoom` world units around `position`, and the
+     * renderer skips every sprite outside of that area before it reaches the draw queue.
+     *
+     * Typical usage:
+     * @code{.cpp}
+     * camera->position = player_position;
+     * level.draw(*renderer, camera->get_view_rect());
+     *
+     * const glm::vec2 cursor = camera->screen_to_world(mouse_position);
+     * @endcode
+     */
+    class Camera {
+        friend class Engine;
+
+    public:
+        /**
+         * @param window_settings The virtual size and scaling mode.
+         * @param window_width The width of the window in pixels.
+         * @param window_height The height of the window in pixels.
+         */
+        Camera(const WindowSettings& window_settings, int window_width, int window_height);
+
+        [[nodiscard]] glm::vec2 get_virtual_size() const noexcept { return m_virtual_size; }
+
+        /**
+         * Returns the area of the world currently in view.
+         */
+        [[nodiscard]] Rect get_view_rect() const noexcept;
+
+        /**
+         * Returns the letterboxed area of the window the virtual resolution is scaled to, in pixels.
+         */
+        [[nodiscard]] const Rect& get_viewport() const noexcept { return m_viewport; }
+
+        /**
+         * Returns the number of window pixels per virtual pixel.
+         */
+        [[nodiscard]] float get_viewport_scale() const noexcept { return m_viewport_scale; }
+
+        /**
+         * Returns the number of window pixels per world unit, the viewport scale times the zoom.
+         */
+        [[nodiscard]] float get_pixel_scale() const noexcept { return m_viewport_scale * zoom; }
+
+        /**
+         * Converts between world positions and window pixels, e.g. to pick what is under the cursor.
+         */
+        [[nodiscard]] glm::vec2 world_to_screen(glm::vec2 world_position) const noexcept;
+        [[nodiscard]] glm::vec2 screen_to_world(glm::vec2 screen_position) const noexcept;
+
+        glm::vec2 position {};   // World position at the center of the view.
+        float zoom { 1.f };      // Greater than 1 zooms in.
+
+    private:
+        glm::vec2 m_virtual_size;
+        bool m_integer_scaling;
+
+        Rect m_viewport {};
+        float m_viewport_scale { 1.f };
+
+        /**
+         * Refits the viewport to a new window size.
+         */
+        void set_window_size(int width, int height) noexcept;
+    };
+} // vn
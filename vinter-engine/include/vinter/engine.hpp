@@ -1,14 +1,26 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
 
 // TODO: Place these in a fwd.hpp.
 #include "vinter/logger.hpp"
 #include "vinter/settings/project_settings.hpp"
 #include "vinter/window.hpp"
+#include "vinter/camera.hpp"
 #include "vinter/color.hpp"
 #include "vinter/renderer.hpp"
+#include "vinter/text_renderer.hpp"
 #include "vinter/time.hpp"
+#include "vinter/profiler.hpp"
+#include "vinter/job_system.hpp"
+#include "vinter/frame_arena.hpp"
+#include "vinter/assets/asset_archive.hpp"
+#include "vinter/assets/asset_manager.hpp"
+#include "vinter/file_watcher.hpp"
+#include "vinter/system_scheduler.hpp"
+#include "vinter/physics/physics_world.hpp"
 #include "vinter/input/keyboard.hpp"
 #include "vinter/input/mouse.hpp"
 #include "vinter/input/gamepad.hpp"
@@ -24,20 +36,74 @@ namespace vn {
         void run();
 
     protected:
+        // Declared first to be destroyed last, after every system that may still have jobs in flight.
+        std::unique_ptr<JobSystem> jobs;
+
+        /**
+         * Scratch memory released at the start of every frame.
+         */
+        std::unique_ptr<FrameArena> frame_arena;
+
+        /**
+         * The archive of `AssetSettings::archive_path`, declared before the renderers to outlive what they load from it.
+         */
+        std::unique_ptr<AssetArchive> archive;
         std::unique_ptr<Window> window;
+
+        /**
+         * The view the frame is rendered through, refitted to the window on resize.
+         */
+        std::unique_ptr<Camera> camera;
         std::unique_ptr<Renderer> renderer;
+        std::unique_ptr<TextRenderer> text;
+
+        /**
+         * Loads textures in the background, from `archive` or from disk, uploading them at the start of every frame.
+         */
+        std::unique_ptr<AssetManager> assets;
+
+        /**
+         * Watches `AssetSettings::watch_directories` and the bindings file, polled at the start of every frame to
+         * reload what changed.
+         */
+        std::unique_ptr<FileWatcher> watcher;
         std::unique_ptr<Time> time;
         std::unique_ptr<DeviceManager> devices;
         std::unique_ptr<InputMap> input;
+        std::unique_ptr<entt::registry> registry;
+
+        /**
+         * Runs the systems added to `registry` every frame, right after `update`.
+         */
+        std::unique_ptr<SystemScheduler> systems;
+
+        /**
+         * Moves and collides the rigid bodies in `registry` before every `fixed_update`.
+         */
+        std::unique_ptr<PhysicsWorld> physics;
 
         virtual void load() {}
         virtual void poll_events() {}
         virtual void update(float delta) {}
+
+        /**
+         * Called zero or more times per frame at the constant rate of `TimeSettings::fixed_delta`,
+         * before `update`, when `TimeSettings::fixed_timestep` is enabled.
+         */
+        virtual void fixed_update(float fixed_delta) {}
         virtual void render() {}
 
         void quit();
 
     private:
         bool m_running { false };
+        bool m_quit_on_replay_end { true };
+        std::vector<FileChange> m_file_changes; // Reused across frames.
+        std::string m_watched_bindings_path;    // Normalized like FileChange::path, empty when not watched.
+
+        /**
+         * Destroys the systems in dependency order, then shuts down SDL and the async logger.
+         */
+        void shutdown();
     };
 } // vn
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vn {
+    /**
+     * A file that was written, created or moved into place since the last poll.
+     */
+    struct FileChange {
+        std::string path;           // The watched directory joined with `relative_path`, with `/` separators.
+        std::string relative_path;  // Relative to the watched directory, or the file name of a watched file.
+    };
+
+    /**
+     * Reports changed files on a background thread, so that edited assets and settings can be reloaded
+     * while the game runs.
+     *
+     * On Linux the thread sleeps on inotify and only reports files once they are closed after writing, or
+     * moved into place as editors do when saving atomically; elsewhere, watched files are compared with
+     * their last modification times twice a second. Files changed several times between two polls are
+     * reported once.
+     *
+     * Typical usage:
+     * @code{.cpp}
+     * FileWatcher watcher;
+     * watcher.watch_directory("assets");
+     *
+     * std::vector<FileChange> changes;
+     * watcher.poll(changes);
+     * for (const FileChange& change : changes) reload(change.path);
+     * @endcode
+     */
+    class FileWatcher {
+    public:
+        FileWatcher();
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        /**
+         * Watches every file in a directory and its subdirectories, including ones created later.
+         *
+         * @return `true` if the directory is watched, `false` otherwise, with the error logged.
+         */
+        bool watch_directory(std::string_view path);
+
+        /**
+         * Watches a single file, which may not exist yet.
+         *
+         * @return `true` if the file is watched, `false` otherwise, with the error logged.
+         */
+        bool watch_file(std::string_view path);
+
+        /**
+         * Replaces the contents of `changes` with the files changed since the last poll.
+         */
+        void poll(std::vector<FileChange>& changes);
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+    };
+} // vn
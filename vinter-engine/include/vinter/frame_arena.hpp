@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vn {
+    /**
+     * Linear allocator for scratch memory that only lives until the end of the frame.
+     *
+     * Allocating bumps an offset into the current block, and the whole arena is released at once when the
+     * engine resets it at the start of every frame. When a frame outgrows the arena, another block is added
+     * and all blocks are merged into a single one on the next reset, so after a few frames the arena settles
+     * on a single block and never touches the heap again.
+     *
+     * Typical usage:
+     * @code{.cpp}
+     * auto* positions = frame_arena->allocate_array<glm::vec2>(count); // Uninitialized.
+     *
+     * std::pmr::vector<Entity> visible { frame_arena->get_resource() };
+     * for (...) visible.push_back(entity);
+     * @endcode
+     *
+     * @note Not thread-safe; allocate from the main thread only. Pointers are invalidated by the next reset,
+     * and destructors of objects created in the arena are never run.
+     */
+    class FrameArena {
+    public:
+        explicit FrameArena(std::size_t capacity);
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        [[nodiscard]] void* allocate(const std::size_t size, const std::size_t alignment = alignof(std::max_align_t)) {
+            const std::uintptr_t address = (m_cursor + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+            if (address + size > m_end) {
+                return allocate_block(size, alignment);
+            }
+            m_cursor = address + size;
+            return reinterpret_cast<void*>(address);
+        }
+
+        /**
+         * Allocates uninitialized storage for `count` objects of type T.
+         */
+        template<typename T>
+        [[nodiscard]] T* allocate_array(const std::size_t count) {
+            return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+        }
+
+        /**
+         * Constructs an object of trivially destructible type T in the arena.
+         */
+        template<typename T, typename... Args>
+        [[nodiscard]] T* create(Args&&... args) {
+            static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed.");
+            return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        /**
+         * Releases every allocation at once, merging the blocks added since the previous reset.
+         */
+        void reset();
+
+        /**
+         * Returns a memory resource that allocates from this arena, for `std::pmr` containers.
+         */
+        [[nodiscard]] std::pmr::memory_resource* get_resource() noexcept { return &m_resource; }
+
+        /**
+         * Returns the bytes allocated since the last reset, alignment padding included.
+         */
+        [[nodiscard]] std::size_t get_used_size() const noexcept;
+        [[nodiscard]] std::size_t get_capacity() const noexcept;
+
+    private:
+        class Resource final : public std::pmr::memory_resource {
+        public:
+            explicit Resource(FrameArena& arena) : m_arena(arena) {}
+
+        private:
+            FrameArena& m_arena;
+
+            void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+                return m_arena.allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void*, std::size_t, std::size_t) override {}
+
+            [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+                return this == &other;
+            }
+        };
+
+        struct Block {
+            std::unique_ptr<std::byte[]> data;
+            std::size_t size;
+        };
+
+        std::vector<Block> m_blocks; // The last block is the one being allocated from.
+        std::size_t m_used_before_current { 0 }; // Bytes used in the blocks before the last one.
+        std::uintptr_t m_cursor { 0 };
+        std::uintptr_t m_end { 0 };
+        Resource m_resource { *this };
+
+        void* allocate_block(std::size_t size, std::size_t alignment);
+        void use_block(Block& block) noexcept;
+    };
+} // vn
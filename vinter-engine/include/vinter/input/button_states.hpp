@@ -1,25 +1,132 @@
 #pragma once
 
 #include <array>
+#include <bit>
+#include <cstdint>
 
 namespace vn {
+    /**
+     * The current and previous pressed states of N buttons, packed one bit per button.
+     *
+     * Refreshing is a copy of N / 64 words, and bulk queries (any, count, iteration) operate
+     * on whole words rather than individual buttons.
+     *
+     * States can either be polled, with `refresh` followed by `set`, or driven by events,
+     * with `press` and `release` between frames followed by `latch`. Event-driven states also keep
+     * the presses and releases seen since the last latch, so a tap that starts and ends between two
+     * frames still reports as both just pressed and just released.
+     */
     template<std::size_t N>
     struct ButtonStates {
-        std::array<bool, N> current {};
-        std::array<bool, N> previous {};
+        using Word = std::uint64_t;
+        static constexpr std::size_t WordBits { 64 };
+        static constexpr std::size_t WordCount { (N + WordBits - 1) / WordBits };
+
+        std::array<Word, WordCount> current {};
+        std::array<Word, WordCount> previous {};
+        std::array<Word, WordCount> pressed_edges {};
+        std::array<Word, WordCount> released_edges {};
+
+        // Event-driven state accumulated since the last latch.
+        std::array<Word, WordCount> pending {};
+        std::array<Word, WordCount> pending_pressed_edges {};
+        std::array<Word, WordCount> pending_released_edges {};
 
         void refresh() {
             previous = current;
+            pressed_edges = {};
+            released_edges = {};
+        }
+
+        void press(const std::size_t button_idx) {
+            const Word mask = Word { 1 } << (button_idx % WordBits);
+            pending[button_idx / WordBits] |= mask;
+            pending_pressed_edges[button_idx / WordBits] |= mask;
+        }
+        void release(const std::size_t button_idx) {
+            const Word mask = Word { 1 } << (button_idx % WordBits);
+            pending[button_idx / WordBits] &= ~mask;
+            pending_released_edges[button_idx / WordBits] |= mask;
+        }
+
+        /**
+         * Makes the state accumulated from events since the last latch the current state.
+         */
+        void latch() {
+            previous = current;
+            current = pending;
+            pressed_edges = pending_pressed_edges;
+            released_edges = pending_released_edges;
+            pending_pressed_edges = {};
+            pending_released_edges = {};
+        }
+
+        void set(const std::size_t button_idx, const bool pressed) {
+            const Word mask = Word { 1 } << (button_idx % WordBits);
+            Word& word = current[button_idx / WordBits];
+            word = pressed ? (word | mask) : (word & ~mask);
+        }
+
+        [[nodiscard]] bool is_pressed(const std::size_t button_idx) const {
+            return bit(current, button_idx);
+        }
+        [[nodiscard]] bool is_just_pressed(const std::size_t button_idx) const {
+            return (get_just_pressed_word(button_idx / WordBits) >> (button_idx % WordBits)) & 1;
+        }
+        [[nodiscard]] bool is_just_released(const std::size_t button_idx) const {
+            return (get_just_released_word(button_idx / WordBits) >> (button_idx % WordBits)) & 1;
+        }
+
+        [[nodiscard]] Word get_just_pressed_word(const std::size_t word_idx) const {
+            return (current[word_idx] & ~previous[word_idx]) | pressed_edges[word_idx];
+        }
+        [[nodiscard]] Word get_just_released_word(const std::size_t word_idx) const {
+            return (~current[word_idx] & previous[word_idx]) | released_edges[word_idx];
+        }
+
+        [[nodiscard]] bool is_any_pressed() const {
+            Word any = 0;
+            for (std::size_t i = 0; i < WordCount; ++i) any |= current[i];
+            return any != 0;
+        }
+        [[nodiscard]] bool is_any_just_pressed() const {
+            Word any = 0;
+            for (std::size_t i = 0; i < WordCount; ++i) any |= get_just_pressed_word(i);
+            return any != 0;
+        }
+        [[nodiscard]] bool is_any_just_released() const {
+            Word any = 0;
+            for (std::size_t i = 0; i < WordCount; ++i) any |= get_just_released_word(i);
+            return any != 0;
         }
 
-        [[nodiscard]] bool is_pressed(std::size_t button_idx) const {
-            return current[button_idx];
+        [[nodiscard]] std::size_t count_pressed() const {
+            std::size_t count = 0;
+            for (const Word word : current) count += std::popcount(word);
+            return count;
         }
-        [[nodiscard]] bool is_just_pressed(std::size_t button_idx) const {
-            return current[button_idx] && !previous[button_idx];
+        [[nodiscard]] std::size_t count_just_pressed() const {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < WordCount; ++i) count += std::popcount(get_just_pressed_word(i));
+            return count;
         }
-        [[nodiscard]] bool is_just_released(std::size_t button_idx) const {
-            return !current[button_idx] && previous[button_idx];
+
+        /**
+         * Calls `func(button_idx)` for every button pressed this frame but not the previous one,
+         * in ascending order.
+         */
+        template<typename Func>
+        void for_each_just_pressed(Func&& func) const {
+            for (std::size_t i = 0; i < WordCount; ++i) {
+                for (Word word = get_just_pressed_word(i); word != 0; word &= word - 1) {
+                    func(i * WordBits + std::countr_zero(word));
+                }
+            }
+        }
+
+    private:
+        [[nodiscard]] static bool bit(const std::array<Word, WordCount>& words, const std::size_t button_idx) {
+            return (words[button_idx / WordBits] >> (button_idx % WordBits)) & 1;
         }
     };
-} // vn
\ No newline at end of file
+} // vn
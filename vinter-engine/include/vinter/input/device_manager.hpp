@@ -1,10 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
 #include <array>
 #include <vector>
 #include <unordered_map>
 #include <optional>
+#include <string_view>
 
 union SDL_Event;
 
@@ -12,6 +14,9 @@ namespace vn {
     class Keyboard;
     class Mouse;
     class Gamepad;
+    struct DeviceSnapshot;
+    class InputRecordWriter;
+    class InputRecordReader;
 
     using DeviceID = std::uint32_t;
 
@@ -20,6 +25,7 @@ namespace vn {
 
     public:
         DeviceManager();
+        ~DeviceManager();
 
         static constexpr std::size_t MaxGamepadCount { 8 };
 
@@ -28,11 +34,56 @@ namespace vn {
         [[nodiscard]] Gamepad* get_gamepad_by_id(DeviceID id) const noexcept;
         [[nodiscard]] Gamepad* get_gamepad(std::size_t slot = 0) const noexcept;
         [[nodiscard]] std::array<Gamepad*, MaxGamepadCount> get_gamepads() const noexcept;
-        [[nodiscard]] std::vector<Gamepad*> get_active_gamepads() const noexcept;
+
+        /**
+         * Returns the connected gamepads in slot order.
+         *
+         * @param resource The memory resource to allocate the result from, e.g. `FrameArena::get_resource()`.
+         */
+        [[nodiscard]] std::pmr::vector<Gamepad*> get_active_gamepads(
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+        ) const;
+
+        /**
+         * Records the state of every device and the frame delta after each update to a binary file.
+         *
+         * @param path The path of the recording file, which is overwritten.
+         * @return `true` if the file could be opened for writing, `false` otherwise.
+         */
+        bool start_recording(std::string_view path);
+        void stop_recording();
+        [[nodiscard]] bool is_recording() const noexcept;
+
+        /**
+         * Replays a recording made with `start_recording`, in place of the devices and the measured frame delta.
+         *
+         * While replaying, device input events are ignored and the gamepad slots hold the recorded gamepads
+         * rather than the connected ones. The replay stops by itself after its last frame.
+         *
+         * @param path The path of the recording file.
+         * @return `true` if the file is a valid recording, `false` otherwise.
+         */
+        bool start_replay(std::string_view path);
+        void stop_replay();
+        [[nodiscard]] bool is_replaying() const noexcept;
+
+        /**
+         * Checks if a replay ran out of frames during the latest update.
+         */
+        [[nodiscard]] bool has_replay_ended() const noexcept;
 
     private:
         void handle_events(const SDL_Event& event);
-        void update();
+
+        /**
+         * Updates every device, then records or replays their state.
+         *
+         * @param delta The measured frame delta, which is recorded, or replaced by the recorded one when replaying.
+         */
+        void update(float& delta);
+
+        void save_snapshot(DeviceSnapshot& snapshot) const;
+        void load_snapshot(const DeviceSnapshot& snapshot);
 
         void handle_gamepad_added(DeviceID id);
         void handle_gamepad_removed(DeviceID id);
@@ -41,5 +92,10 @@ namespace vn {
         std::unique_ptr<Mouse> m_mouse;
         std::array<std::optional<DeviceID>, MaxGamepadCount> m_gamepad_slots;
         std::unordered_map<DeviceID, std::unique_ptr<Gamepad>> m_gamepads;
+
+        std::unique_ptr<InputRecordWriter> m_recording;
+        std::unique_ptr<InputRecordReader> m_replay;
+        std::array<std::unique_ptr<Gamepad>, MaxGamepadCount> m_replay_gamepads;
+        bool m_replay_ended { false };
     };
 } // vn
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -7,6 +8,7 @@ union SDL_Event;
 
 namespace vn {
     struct Color;
+    struct GamepadSnapshot;
 
     class Gamepad {
         friend class DeviceManager;
@@ -74,15 +76,28 @@ namespace vn {
         [[nodiscard]] bool is_axis_just_released(Axis axis) const noexcept;
         [[nodiscard]] float get_axis_strength(Axis axis) const noexcept;
 
+        /**
+         * Returns when the button was last pressed or released, which can fall anywhere between two frames.
+         *
+         * @return The SDL timestamp of the button's latest event in nanoseconds, or 0 if it has none.
+         */
+        [[nodiscard]] std::uint64_t get_button_timestamp(Button button) const noexcept;
+
         void begin_vibrate(float weak_percent_magnitude, float strong_percent_magnitude, float duration_sec = 0.f) const;
         void stop_vibrate() const;
 
         void set_led_color(Color color) const;
 
     private:
+        // Constructs a gamepad without an SDL device, whose state is only ever loaded from snapshots.
+        Gamepad();
+
         void handle_events(const SDL_Event& event);
         void update();
 
+        void save_snapshot(GamepadSnapshot& snapshot) const;
+        void load_snapshot(const GamepadSnapshot& snapshot);
+
         float m_stick_deadzone { 0.1f };
         float m_trigger_deadzone { 0.05f };
 
@@ -1,22 +1,54 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <unordered_map>
 #include <variant>
 #include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
 
 #include "vinter/input/keyboard.hpp"
 #include "vinter/input/mouse.hpp"
 #include "vinter/input/gamepad.hpp"
+#include "vinter/input/device_manager.hpp"
 #include "vinter/utils/hash.hpp"
 
 namespace vn {
-    class DeviceManager;
-
     /**
      * The unique hashed identifier corresponding to an action name.
      */
     using ActionID = std::uint64_t;
 
+    /**
+     * Hashes an action name at compile time, for resolving actions without runtime string hashing.
+     *
+     * @code{.cpp}
+     * static constexpr ActionID Jump = action_id("jump");
+     * @endcode
+     */
+    [[nodiscard]] consteval ActionID action_id(const std::string_view action_name) noexcept {
+        return fnv1a_64(action_name);
+    }
+
+    /**
+     * A resolved reference to a registered action, valid for the lifetime of the InputMap that returned it.
+     *
+     * Querying an action through its handle skips name hashing and the action lookup entirely.
+     */
+    struct ActionHandle {
+        static constexpr std::uint32_t InvalidIndex { 0xFFFFFFFF };
+
+        std::uint32_t index { InvalidIndex };
+
+        [[nodiscard]] constexpr bool is_valid() const noexcept { return index != InvalidIndex; }
+        constexpr bool operator==(const ActionHandle&) const = default;
+    };
+
     /**
      * The type of device-specific input method to bind to a generic input action.
      */
@@ -49,10 +81,21 @@ namespace vn {
      * - Single-frame events (`is_action_just_pressed`, `is_action_just_released`)
      * - Action strength queries (`get_action_strength`) for analog inputs like gamepad axes.
      *
+     * Every action can be queried by name or, without any per-query hashing or lookup, by the
+     * ActionHandle returned from `bind` or `get_action`.
+     *
+     * All bound actions are resolved once per frame, right after the devices update, so every query
+     * is a table lookup and repeated queries within a frame always agree. Actions bound mid-frame
+     * report as released until the next resolve.
+     *
      * Each binding can be device-agnostic (applies to all connected gamepads) or tied
      * to a specific device slot. InputMap queries all active devices safely, even if
      * some gamepads are disconnected.
      *
+     * Bindings can also be loaded from a file instead of being bound in code, either an editable text
+     * file written by `save_bindings` or a compiled binary file written by `save_compiled_bindings`,
+     * which loads with a single read and no parsing.
+     *
      * Typical usage:
      * @code{.cpp}
      * auto devices = std::make_unique<DeviceManager>();
@@ -71,6 +114,15 @@ namespace vn {
      * }
      *
      * player.jump_initial_velocity.y = input->get_action_strength("jump");
+     *
+     * // Or loading them from a file, such as one saved by a rebinding menu.
+     * input->load_bindings("bindings.txt");
+     *
+     * // Resolving actions once, then querying them by handle.
+     * const ActionHandle jump = input->get_action("jump");
+     * if (input->is_action_just_pressed(jump)) {
+     *      player.jump();
+     * }
      * @endcode
      *
      * @note InputMap requires a valid DeviceManager reference for querying device states.
@@ -89,40 +141,45 @@ namespace vn {
          *
          * @param action_name The name of a registered action.
          * @param key The key to be bound.
+         * @return The handle of the action.
          */
-        void bind(std::string_view action_name, Keyboard::Key key);
+        ActionHandle bind(std::string_view action_name, Keyboard::Key key);
 
         /**
          *  Binds a registered action to a mouse button.
          *
          * @param action_name The name of a registered action.
          * @param button The mouse button to be bound.
+         * @return The handle of the action.
          */
-        void bind(std::string_view action_name, Mouse::Button button);
+        ActionHandle bind(std::string_view action_name, Mouse::Button button);
 
         /**
          *  Binds a registered action to a mouse wheel input.
          *
          * @param action_name The name of a registered action.
          * @param wheel The mouse wheel input to be bound.
+         * @return The handle of the action.
          */
-        void bind(std::string_view action_name, Mouse::Wheel wheel);
+        ActionHandle bind(std::string_view action_name, Mouse::Wheel wheel);
 
         /**
          *  Binds a registered action to a gamepad button, for all gamepads.
          *
          * @param action_name The name of a registered action.
          * @param button The gamepad button to be bound.
+         * @return The handle of the action.
          */
-        void bind(std::string_view action_name, Gamepad::Button button);
+        ActionHandle bind(std::string_view action_name, Gamepad::Button button);
 
         /**
          *  Binds a registered action to a gamepad axis, for all gamepads.
          *
          * @param action_name The name of a registered action.
          * @param axis The gamepad axis to be bound.
+         * @return The handle of the action.
          */
-        void bind(std::string_view action_name, Gamepad::Axis axis);
+        ActionHandle bind(std::string_view action_name, Gamepad::Axis axis);
 
         /**
          *  Binds a registered action to a gamepad button, for a specified gamepad.
@@ -130,8 +187,9 @@ namespace vn {
          * @param action_name The name of a registered action.
          * @param button The gamepad button to be bound.
          * @param slot The slot number of the gamepad to be bound.
+         * @return The handle of the action.
          */
-        void bind(std::string_view action_name, Gamepad::Button button, std::size_t slot);
+        ActionHandle bind(std::string_view action_name, Gamepad::Button button, std::size_t slot);
 
         /**
          *  Binds a registered action to a gamepad axis, for a specified gamepad.
@@ -139,8 +197,85 @@ namespace vn {
          * @param action_name The name of a registered action.
          * @param axis The gamepad axis to be bound.
          * @param slot The slot number of the gamepad to be bound.
+         * @return The handle of the action.
+         */
+        ActionHandle bind(std::string_view action_name, Gamepad::Axis axis, std::size_t slot);
+
+        /**
+         * Removes every binding of an action, to rebind it. Its handle stays valid.
+         *
+         * @param action_name The name of a registered action.
+         */
+        void unbind(std::string_view action_name);
+
+        /**
+         * Replaces the bindings of every action with those of a bindings file, text or compiled.
+         *
+         * Actions keep their handles: actions missing from the file are left without bindings, and
+         * actions new to the map are added.
+         *
+         * @param path The path of a file written by `save_bindings` or `save_compiled_bindings`.
+         * @return `true` if the bindings were loaded, `false` otherwise, with the error logged and the
+         * bindings unchanged.
+         */
+        bool load_bindings(std::string_view path);
+
+        /**
+         * Writes every binding to an editable text file, one binding per line:
+         *
+         * @code
+         * # <action> <method> <input> [<gamepad slot>]
+         * jump    key             Space
+         * jump    gamepad_button  South
+         * steer   gamepad_axis    LeftStickLeft  1
+         * @endcode
+         *
+         * The methods are `key`, `mouse_button`, `mouse_wheel`, `gamepad_button` and `gamepad_axis`, and the
+         * inputs are named after their enumerators, number keys without their leading underscore. Text
+         * after `#` is a comment.
+         *
+         * @return `true` if the file was written, `false` otherwise, with the error logged.
+         * @note The file is replaced atomically, so a FileWatcher never reports it half written.
+         */
+        bool save_bindings(std::string_view path) const;
+
+        /**
+         * Writes every binding to a compiled binary file, for shipping.
+         *
+         * @return `true` if the file was written, `false` otherwise, with the error logged.
+         */
+        bool save_compiled_bindings(std::string_view path) const;
+
+        /**
+         * Returns the bindings of an action, such as for listing them in a rebinding menu.
+         */
+        [[nodiscard]] std::vector<Binding> get_bindings(ActionHandle action) const;
+
+        /**
+         * Returns the name of an action, or an empty name for an invalid handle.
+         */
+        [[nodiscard]] std::string_view get_action_name(ActionHandle action) const;
+
+        /**
+         * Returns the number of registered actions, whose handles are the indices [0, count).
+         */
+        [[nodiscard]] std::size_t get_action_count() const noexcept { return m_actions.size(); }
+
+        /**
+         * Resolves a registered action by name.
+         *
+         * @param action_name The name of a registered action.
+         * @return The handle of the action, or an invalid handle if the action was never bound.
          */
-        void bind(std::string_view action_name, Gamepad::Axis axis, std::size_t slot);
+        [[nodiscard]] ActionHandle get_action(std::string_view action_name) const;
+
+        /**
+         * Resolves a registered action by its hashed identifier (see `action_id`).
+         *
+         * @param id The identifier of a registered action.
+         * @return The handle of the action, or an invalid handle if the action was never bound.
+         */
+        [[nodiscard]] ActionHandle get_action(ActionID id) const;
 
         /**
          * Checks if a registered action is actively pressed during the current frame.
@@ -149,6 +284,7 @@ namespace vn {
          * @return `true` if the action is currently pressed, `false` otherwise.
          */
         [[nodiscard]] bool is_action_pressed(std::string_view action_name) const;
+        [[nodiscard]] bool is_action_pressed(ActionHandle action) const;
 
         /**
          * Checks if a registered action was pressed this frame but not in the previous frame.
@@ -159,6 +295,7 @@ namespace vn {
          * @return `true` if the action was just pressed in the current frame, `false` otherwise.
          */
         [[nodiscard]] bool is_action_just_pressed(std::string_view action_name) const;
+        [[nodiscard]] bool is_action_just_pressed(ActionHandle action) const;
 
         /**
          * Checks if a registered action was released this frame but was pressed in the previous frame.
@@ -169,6 +306,7 @@ namespace vn {
          * @return `true` if the action was just released in the current frame, `false` otherwise.
          */
         [[nodiscard]] bool is_action_just_released(std::string_view action_name) const;
+        [[nodiscard]] bool is_action_just_released(ActionHandle action) const;
 
         /**
          * Returns the normalized strength of the specified action in the range [0.0, 1.0].
@@ -183,29 +321,105 @@ namespace vn {
          * @return The normalized strength of the action in the range [0.0, 1.0].
          */
         [[nodiscard]] float get_action_strength(std::string_view action_name) const;
+        [[nodiscard]] float get_action_strength(ActionHandle action) const;
 
     private:
-        enum class PressedState {
-            Pressed,
-            JustPressed,
-            JustReleased
+        friend class Engine;
+
+        enum class PressedState : std::uint8_t {
+            Pressed      = 1 << 0,
+            JustPressed  = 1 << 1,
+            JustReleased = 1 << 2,
         };
 
+        /**
+         * A binding flattened into plain data, so evaluation is a switch instead of a variant visit.
+         */
+        struct CompiledBinding {
+            enum class Kind : std::uint8_t {
+                Key, MouseButton, MouseWheel, GamepadButton, GamepadAxis,
+            };
+            static constexpr std::int8_t AllSlots { -1 };
+
+            Kind kind;
+            std::int8_t gamepad_slot { AllSlots };
+            std::uint16_t code;
+        };
+
+        /**
+         * The contiguous range of an action's bindings within the flat binding array, and of its name
+         * within the names buffer.
+         *
+         * @note Stored as is in compiled bindings files.
+         */
+        struct Action {
+            ActionID id;
+            std::uint32_t binding_offset;
+            std::uint32_t binding_count;
+            std::uint32_t name_offset;
+            std::uint32_t name_size;
+        };
+
+        /**
+         * The actions, bindings and names of a bindings file, laid out like the map's own.
+         */
+        struct BindingTable {
+            std::vector<Action> actions;
+            std::vector<CompiledBinding> bindings;
+            std::string names;
+        };
+
+        /**
+         * The state of an action (or a single binding) as resolved for the current frame.
+         */
+        struct ActionState {
+            std::uint8_t pressed_states { 0 }; // Bitwise OR of PressedState flags.
+            float strength { 0.f };
+
+            void merge(const ActionState& other) noexcept {
+                pressed_states |= other.pressed_states;
+                strength = std::max(strength, other.strength);
+            }
+        };
+
+        using GamepadSlots = std::array<Gamepad*, DeviceManager::MaxGamepadCount>;
+
         [[nodiscard]] static constexpr ActionID to_action_id(const std::string_view name) noexcept {
             return fnv1a_64(name);
         }
 
-        bool check_action_pressed_state(std::string_view action_name, PressedState state) const;
-        bool evaluate_binding_pressed(const Binding& binding, PressedState state) const;
-        float evaluate_input_strength(const Binding& binding) const;
+        [[nodiscard]] static CompiledBinding compile_binding(const Binding& binding) noexcept;
+        [[nodiscard]] static Binding decompile_binding(const CompiledBinding& binding) noexcept;
+
+        ActionHandle add_binding(std::string_view action_name, const Binding& binding);
+
+        /**
+         * Replaces all bindings, keeping every registered action at its index.
+         */
+        bool replace_bindings(BindingTable&& table);
 
-        bool evaluate_key_pressed_state(Keyboard::Key key, PressedState state) const;
-        bool evaluate_mouse_button_pressed_state(Mouse::Button button, PressedState state) const;
-        bool evaluate_mouse_wheel_pressed_state(Mouse::Wheel wheel, PressedState state) const;
-        bool evaluate_gamepad_button_pressed_state(Gamepad::Button button, const Binding& binding, PressedState state) const;
-        bool evaluate_gamepad_axis_pressed_state(Gamepad::Axis axis, const Binding& binding, PressedState state) const;
+        // Defined with the bindings file formats.
+        static bool parse_bindings(std::string_view text, std::string_view path, BindingTable& table);
+        static bool read_compiled_bindings(std::span<const std::byte> data, std::string_view path, BindingTable& table);
+
+        /**
+         * Resolves the state of every bound action against the devices, once per frame.
+         */
+        void update();
+
+        bool check_action_pressed_state(ActionHandle action, PressedState state) const;
+        ActionState resolve_binding(const CompiledBinding& binding, const GamepadSlots& gamepads) const;
+
+        static ActionState resolve_gamepad_button(const Gamepad& gamepad, Gamepad::Button button);
+        static ActionState resolve_gamepad_axis(const Gamepad& gamepad, Gamepad::Axis axis);
 
         DeviceManager& m_devices;
-        std::unordered_map<ActionID, std::vector<Binding>> m_bindings;
+
+        // Name resolution only; queries by handle index straight into the arrays below.
+        std::unordered_map<ActionID, std::uint32_t> m_action_lookup;
+        std::vector<Action> m_actions;
+        std::vector<CompiledBinding> m_bindings; // Grouped by action, in action order.
+        std::vector<ActionState> m_action_states; // Parallel to m_actions.
+        std::string m_action_names;
     };
 } // vn
\ No newline at end of file
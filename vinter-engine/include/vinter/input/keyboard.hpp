@@ -1,10 +1,15 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <memory_resource>
+#include <vector>
 
 union SDL_Event;
 
 namespace vn {
+    struct KeyboardSnapshot;
+
     class Keyboard {
         friend class DeviceManager;
 
@@ -54,10 +59,46 @@ namespace vn {
         [[nodiscard]] bool is_key_just_pressed(Key key) const;
         [[nodiscard]] bool is_key_just_released(Key key) const;
 
+        /**
+         * Returns when the key was last pressed or released, which can fall anywhere between two frames.
+         *
+         * @return The SDL timestamp of the key's latest event in nanoseconds, or 0 if it has none.
+         */
+        [[nodiscard]] std::uint64_t get_key_timestamp(Key key) const;
+
+        /**
+         * Checks if any key is held, including keys that have no corresponding Key value.
+         */
+        [[nodiscard]] bool is_any_key_pressed() const;
+
+        /**
+         * Checks if any key was pressed this frame but not in the previous frame, including keys
+         * that have no corresponding Key value.
+         */
+        [[nodiscard]] bool is_any_key_just_pressed() const;
+
+        /**
+         * Returns the number of keys currently held.
+         */
+        [[nodiscard]] std::size_t get_pressed_key_count() const;
+
+        /**
+         * Returns every key pressed this frame but not in the previous frame, e.g. for rebinding screens.
+         *
+         * @param resource The memory resource to allocate the result from, e.g. `FrameArena::get_resource()`.
+         * @return The just pressed keys, in scancode order.
+         */
+        [[nodiscard]] std::pmr::vector<Key> get_just_pressed_keys(
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+        ) const;
+
     private:
         void handle_events(const SDL_Event& event);
         void update();
 
+        void save_snapshot(KeyboardSnapshot& snapshot) const;
+        void load_snapshot(const KeyboardSnapshot& snapshot);
+
         struct Impl;
         std::unique_ptr<Impl> m_impl;
     };
@@ -7,6 +7,8 @@
 union SDL_Event;
 
 namespace vn {
+    struct MouseSnapshot;
+
     class Mouse {
         friend class DeviceManager;
 
@@ -37,9 +39,13 @@ namespace vn {
         void handle_events(const SDL_Event& event);
         void update();
 
+        void save_snapshot(MouseSnapshot& snapshot) const;
+        void load_snapshot(const MouseSnapshot& snapshot);
+
         ButtonStates<5> m_buttons {};
         glm::vec2 m_position {};
         glm::vec2 m_position_previous {};
         glm::vec2 m_scroll {};
+        glm::vec2 m_scroll_pending {};
     };
 } // vn
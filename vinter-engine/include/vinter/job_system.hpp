@@ -0,0 +1,178 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vn {
+    struct JobSettings;
+    class JobCounter;
+    class JobSystem;
+
+    /**
+     * A unit of work with its callable stored inline, so scheduling never allocates.
+     */
+    class Job {
+    public:
+        // Maximum size of a job's callable; capture large state by reference or pointer.
+        static constexpr std::size_t StorageSize { 40 };
+
+    private:
+        friend class JobSystem;
+
+        using Invoke = void (*)(Job& job);
+
+        alignas(std::max_align_t) std::byte m_storage[StorageSize];
+        Invoke m_invoke { nullptr };
+        JobCounter* m_counter { nullptr };
+        std::atomic<bool> m_in_use { false };
+    };
+
+    /**
+     * Counts the unfinished jobs of a group, to wait on them or to schedule jobs that depend on them.
+     *
+     * @note A counter must outlive the jobs scheduled with it, and the jobs scheduled after it.
+     */
+    class JobCounter {
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        [[nodiscard]] bool is_done() const noexcept {
+            return m_pending.load(std::memory_order_seq_cst) == 0 && m_finishing.load(std::memory_order_seq_cst) == 0;
+        }
+
+    private:
+        friend class JobSystem;
+
+        std::atomic<std::uint32_t> m_pending { 0 };
+        // Jobs between their decrement of m_pending and their last access of this counter.
+        std::atomic<std::uint32_t> m_finishing { 0 };
+
+        std::mutex m_mutex;
+        std::vector<Job*> m_continuations;
+    };
+
+    /**
+     * Runs jobs on a pool of worker threads, one per hardware core besides the main thread.
+     *
+     * Every worker (the main thread included) owns a work-stealing deque: it pushes and pops its own jobs
+     * at one end, and idle workers steal from the other end of a random victim's deque. Waiting on a
+     * counter executes other jobs instead of blocking, so jobs may schedule and wait on nested jobs.
+     *
+     * Typical usage:
+     * @code{.cpp}
+     * JobCounter physics;
+     * jobs->schedule(physics, [&] { world.step(); });
+     *
+     * JobCounter animation;
+     * jobs->schedule_after(physics, animation, [&] { world.animate(); }); // Starts once `physics` is done.
+     *
+     * jobs->parallel_for(sprites.size(), [&](std::size_t i) { sprites[i].cull(camera); });
+     * jobs->wait(animation);
+     * @endcode
+     *
+     * @note Jobs may only be scheduled from the main thread or from within other jobs.
+     */
+    class JobSystem {
+    public:
+        // Jobs that a single thread can have in flight at once.
+        static constexpr std::size_t JobsPerThread { 4096 };
+
+        explicit JobSystem(const JobSettings& job_settings);
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /**
+         * Returns the number of threads executing jobs, the main thread included.
+         */
+        [[nodiscard]] std::size_t get_thread_count() const noexcept;
+
+        /**
+         * Schedules `function()` to run on any worker, counted by `counter`.
+         */
+        template<typename F>
+        void schedule(JobCounter& counter, F&& function) {
+            submit(make_job(counter, std::forward<F>(function)));
+        }
+
+        /**
+         * Schedules `function()` to run on any worker once all jobs counted by `dependency` have finished.
+         */
+        template<typename F>
+        void schedule_after(JobCounter& dependency, JobCounter& counter, F&& function) {
+            submit_after(dependency, make_job(counter, std::forward<F>(function)));
+        }
+
+        /**
+         * Executes other jobs until all jobs counted by `counter` have finished.
+         */
+        void wait(JobCounter& counter);
+
+        /**
+         * Calls `function(i)` for every i in [0, count) across all workers, and waits for all of them.
+         *
+         * @param count The number of iterations.
+         * @param batch_size The number of iterations per job, or 0 to split the range evenly across workers.
+         * @param function The callable to invoke for every iteration.
+         */
+        template<typename F>
+        void parallel_for(const std::size_t count, const std::size_t batch_size, F&& function) {
+            if (count == 0) return;
+
+            const std::size_t batch = batch_size != 0
+                ? batch_size
+                : std::max<std::size_t>(1, count / (get_thread_count() * 4));
+
+            JobCounter counter;
+            for (std::size_t begin = 0; begin < count; begin += batch) {
+                const std::size_t end = std::min(count, begin + batch);
+                schedule(counter, [&function, begin, end] {
+                    for (std::size_t i = begin; i < end; ++i) function(i);
+                });
+            }
+            wait(counter);
+        }
+
+        template<typename F>
+        void parallel_for(const std::size_t count, F&& function) {
+            parallel_for(count, 0, std::forward<F>(function));
+        }
+
+    private:
+        template<typename F>
+        Job* make_job(JobCounter& counter, F&& function) {
+            using Function = std::decay_t<F>;
+            static_assert(sizeof(Function) <= Job::StorageSize, "Job callable is too large, capture by reference.");
+            static_assert(alignof(Function) <= alignof(std::max_align_t), "Job callable is over-aligned.");
+
+            Job* job = allocate_job();
+            new (job->m_storage) Function(std::forward<F>(function));
+            job->m_invoke = [](Job& self) {
+                auto* stored = std::launder(reinterpret_cast<Function*>(self.m_storage));
+                (*stored)();
+                stored->~Function();
+            };
+            job->m_counter = &counter;
+            counter.m_pending.fetch_add(1, std::memory_order_relaxed);
+            return job;
+        }
+
+        Job* allocate_job();
+        void submit(Job* job);
+        void submit_after(JobCounter& dependency, Job* job);
+
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+    };
+} // vn
@@ -1,8 +1,21 @@
 #pragma once
 
-#include <iostream>
+#include <cstdint>
+#include <string_view>
+
+// Debug messages are compiled out of release builds, unless explicitly kept.
+#if !defined(VINTER_LOG_STRIP_DEBUG) && defined(NDEBUG) && !defined(VINTER_LOG_KEEP_DEBUG)
+    #define VINTER_LOG_STRIP_DEBUG
+#endif
 
 namespace vn {
+    /**
+     * Writes leveled messages to the console or a file.
+     *
+     * By default messages are written synchronously by the calling thread. In async mode, callers only copy
+     * the message into a lock-free multi-producer ring buffer, and a background thread drains it to the output.
+     * Messages that do not fit into a full buffer are dropped and counted instead of blocking the caller.
+     */
     class Logger {
     public:
         enum class Level {
@@ -12,15 +25,47 @@ namespace vn {
             Error
         };
 
+#if defined(VINTER_LOG_STRIP_DEBUG)
+        static constexpr bool DebugEnabled { false };
+#else
+        static constexpr bool DebugEnabled { true };
+#endif
+
+        // Maximum length of a single message in async mode; longer messages are truncated.
+        static constexpr std::size_t MaxAsyncMessageLength { 240 };
+
         Logger() = default;
 
-        static void debug(std::string_view msg);
+        static void debug(std::string_view msg) {
+            if constexpr (DebugEnabled) log(Level::Debug, msg);
+        }
         static void info(std::string_view msg);
         static void warning(std::string_view msg);
         static void error(std::string_view msg);
 
+        /**
+         * Switches to async mode, draining messages on a background thread.
+         *
+         * @param file_path The output file path, or empty to log to the console.
+         */
+        static void start_async(std::string_view file_path = {});
+
+        /**
+         * Writes all pending messages, stops the background thread and switches back to synchronous mode.
+         *
+         * @note Must not race with other threads still logging.
+         */
+        static void stop_async();
+
+        [[nodiscard]] static bool is_async();
+
+        /**
+         * Returns the number of messages dropped because the async buffer was full.
+         */
+        [[nodiscard]] static std::uint64_t get_dropped_count();
+
     private:
         static void log(Level level, std::string_view message);
         static std::string_view to_string(Level level);
     };
-} // vn
\ No newline at end of file
+} // vn
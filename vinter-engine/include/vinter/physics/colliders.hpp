@@ -0,0 +1,45 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <entt/entity/registry.hpp>
+
+namespace vn {
+    /**
+     * The motion of an entity simulated by the PhysicsWorld. Entities collide once they also have a
+     * BoxCollider or a CircleCollider.
+     */
+    struct RigidBody {
+        glm::vec2 position {};
+        glm::vec2 velocity {};
+        float inverse_mass { 1.f };     // Zero for static bodies, which are never moved by the simulation.
+        float restitution { 0.f };      // Bounciness, from 0 (none) to 1 (no energy lost).
+        float friction { 0.2f };
+        float gravity_scale { 1.f };
+    };
+
+    /**
+     * An axis-aligned box centered on the body's position plus `offset`.
+     */
+    struct BoxCollider {
+        glm::vec2 half_extents { 8.f };
+        glm::vec2 offset {};
+    };
+
+    /**
+     * A circle centered on the body's position plus `offset`.
+     */
+    struct CircleCollider {
+        float radius { 8.f };
+        glm::vec2 offset {};
+    };
+
+    /**
+     * A pair of touching colliders found by the last physics step.
+     */
+    struct Contact {
+        entt::entity a { entt::null };
+        entt::entity b { entt::null };
+        glm::vec2 normal {};        // Points from `a` towards `b`.
+        float penetration { 0.f };  // Overlap along the normal before the step resolved it.
+    };
+} // vn
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory>
+#include <span>
+
+#include <glm/glm.hpp>
+#include <entt/entity/registry.hpp>
+
+#include "vinter/physics/colliders.hpp"
+
+namespace vn {
+    struct PhysicsSettings;
+    class JobSystem;
+
+    /**
+     * Simulates the RigidBody components of a registry, colliding those with a BoxCollider or a CircleCollider.
+     *
+     * Every step, gravity is applied, colliders are entered into a uniform grid that only pairs up colliders
+     * sharing a cell, the pairs are tested in parallel on the JobSystem's workers, and the contacts found are
+     * resolved with a few passes of sequential impulses followed by a positional correction. The cost grows
+     * with the number of bodies and their neighbours, never with every pair of bodies.
+     *
+     * Typical usage:
+     * @code{.cpp}
+     * const entt::entity crate = registry->create();
+     * registry->emplace<RigidBody>(crate, RigidBody { .position = { 320.f, 0.f } });
+     * registry->emplace<BoxCollider>(crate, BoxCollider { .half_extents = { 8.f, 8.f } });
+     *
+     * for (const Contact& contact : physics->get_contacts()) {
+     *     if (registry->all_of<Bomb>(contact.a)) explode(contact.a);
+     * }
+     * @endcode
+     *
+     * @note Bodies are moved at the fixed rate of `fixed_update`, right before it is called.
+     */
+    class PhysicsWorld {
+        friend class Engine;
+
+    public:
+        PhysicsWorld(entt::registry& registry, JobSystem& jobs, const PhysicsSettings& physics_settings);
+        ~PhysicsWorld();
+
+        PhysicsWorld(const PhysicsWorld&) = delete;
+        PhysicsWorld& operator=(const PhysicsWorld&) = delete;
+
+        void set_gravity(glm::vec2 gravity) noexcept;
+        [[nodiscard]] glm::vec2 get_gravity() const noexcept;
+
+        /**
+         * Returns the contacts found by the last step, valid until the next one.
+         */
+        [[nodiscard]] std::span<const Contact> get_contacts() const noexcept;
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+
+        /**
+         * Advances the simulation by a fixed step.
+         */
+        void step(float delta);
+    };
+} // vn
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace vn {
+    struct Rect {
+        float x { 0.f }, y { 0.f };
+        float width { 0.f }, height { 0.f };
+
+        [[nodiscard]] constexpr bool is_empty() const noexcept {
+            return width <= 0.f || height <= 0.f;
+        }
+
+        [[nodiscard]] constexpr glm::vec2 get_position() const noexcept { return { x, y }; }
+        [[nodiscard]] constexpr glm::vec2 get_size() const noexcept { return { width, height }; }
+
+        [[nodiscard]] constexpr bool overlaps(const Rect& other) const noexcept {
+            return x < other.x + other.width  && other.x < x + width &&
+                   y < other.y + other.height && other.y < y + height;
+        }
+    };
+} // vn
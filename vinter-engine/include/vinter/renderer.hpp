@@ -1,12 +1,24 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <span>
+#include <string_view>
 
 #include "vinter/color.hpp"
+#include "vinter/texture.hpp"
+#include "vinter/sprite.hpp"
+#include "vinter/vertex.hpp"
 
 namespace vn {
     struct RendererSettings;
     class Window;
+    class DrawQueue;
+    class RenderThread;
+    class Camera;
+    class TransformBatch;
 
     class Renderer {
         friend class Engine;
@@ -17,13 +29,201 @@ namespace vn {
 
         void set_clear_color(Color color);
 
+        /**
+         * Loads an image file (BMP or PNG) into a new texture.
+         *
+         * @param path The path of the image file.
+         * @return The loaded texture, or an invalid texture on failure.
+         */
+        [[nodiscard]] Texture load_texture(std::string_view path);
+
+        /**
+         * Decodes an image file (BMP or PNG) already in memory, such as a file of an AssetArchive, into a new texture.
+         *
+         * @return The loaded texture, or an invalid texture on failure.
+         */
+        [[nodiscard]] Texture load_texture(std::span<const std::byte> data);
+
+        /**
+         * Creates a texture from tightly packed 8-bit RGBA pixels.
+         *
+         * @param width The width of the texture in pixels.
+         * @param height The height of the texture in pixels.
+         * @param rgba_pixels The pixel data, or nullptr for an uninitialized texture.
+         * @return The created texture, or an invalid texture on failure.
+         */
+        [[nodiscard]] Texture create_texture(int width, int height, const void* rgba_pixels);
+
+        /**
+         * Replaces a region of a texture with tightly packed 8-bit RGBA pixels.
+         */
+        void update_texture(Texture texture, int x, int y, int width, int height, const void* rgba_pixels);
+
+        void destroy_texture(Texture texture);
+
+        /**
+         * Queues a sprite to be drawn at the end of the current frame.
+         *
+         * Queued sprites are sorted by layer and texture, and every run of sprites that shares a texture
+         * is submitted to the backend as a single batch. Sprites entirely outside of the camera's view
+         * are discarded right away.
+         */
+        void draw_sprite(const Sprite& sprite);
+
+        /**
+         * Queues one instance of a sprite per transform of a batch, to be drawn at the end of the current frame.
+         *
+         * Each instance is moved by its transform's position, turned by its rotation and scaled around the
+         * sprite's origin by its scale. The whole batch is sorted as one sprite and expanded into quads in a
+         * single vectorized pass, which is far cheaper than drawing every instance as its own sprite. Batches
+         * are not culled, callers are expected to keep batches of off-screen instances apart.
+         *
+         * @param sprite The sprite shared by every instance, whose position and rotation offset all of them.
+         * @param transforms The transforms of the instances.
+         */
+        void draw_sprites(const Sprite& sprite, const TransformBatch& transforms);
+
+        /**
+         * Queues prebuilt geometry to be drawn at the end of the current frame, e.g. cached tilemap chunks.
+         *
+         * The vertices are copied as-is, without any per-quad work, and batched like sprites. They are not
+         * culled, callers are expected to only submit geometry near the view, see `get_view_rect`.
+         *
+         * @param texture The texture of all quads.
+         * @param layer The layer of all quads.
+         * @param vertices Axis-aligned quads of four vertices each, clockwise from the top-left corner.
+         */
+        void draw_quads(Texture texture, std::int32_t layer, std::span<const Vertex> vertices);
+
+        /**
+         * Queues a sprite in screen space, for HUDs and overlays: positioned in virtual units from the top-left
+         * corner of the letterboxed viewport, regardless of the camera's position and zoom. Screen space is drawn
+         * over world space, sorted by layer and texture like it. Not culled.
+         */
+        void draw_screen_sprite(const Sprite& sprite);
+
+        /**
+         * Queues prebuilt geometry in screen space, like `draw_screen_sprite`, e.g. laid out text.
+         *
+         * @param texture The texture of all quads.
+         * @param layer The layer of all quads, among the other quads and sprites in screen space.
+         * @param vertices Axis-aligned quads of four vertices each, clockwise from the top-left corner.
+         */
+        void draw_screen_quads(Texture texture, std::int32_t layer, std::span<const Vertex> vertices);
+
+        /**
+         * Returns the area of the world in view of the camera, outside of which sprites are culled.
+         */
+        [[nodiscard]] const Rect& get_view_rect() const noexcept { return m_view_rect; }
+
+        /**
+         * Returns whether frames are submitted on a dedicated render thread, see `RendererSettings::threaded`.
+         */
+        [[nodiscard]] bool is_threaded() const noexcept;
+
     protected:
+        /**
+         * Maps world positions to pixels relative to the viewport: `pixel = world * scale + offset`.
+         */
+        struct View {
+            glm::vec2 scale { 1.f };
+            glm::vec2 offset { 0.f };
+            Rect viewport {};   // Area of the render target in pixels, empty for all of it.
+        };
+
+        Renderer();
+
+        /**
+         * Returns the clear color of the frame being submitted.
+         */
         [[nodiscard]] Color get_clear_color() const;
 
+        /**
+         * Returns the view of the frame being submitted.
+         */
+        [[nodiscard]] const View& get_view() const;
+
+        /**
+         * Returns the draw queue of the frame being submitted.
+         */
+        [[nodiscard]] DrawQueue& get_draw_queue() const;
+
+        /**
+         * Returns the screen space draw queue of the frame being submitted, drawn after the world's.
+         */
+        [[nodiscard]] DrawQueue& get_screen_draw_queue() const;
+
+        /**
+         * Returns the view of the screen space draw queue of the frame being submitted, which only scales
+         * virtual units to the viewport.
+         */
+        [[nodiscard]] const View& get_screen_view() const;
+
     private:
         Color m_clear_color { colors::Black };
+        Color m_submit_clear_color { colors::Black };
+
+        View m_view {};
+        View m_submit_view {};
+        View m_screen_view {};
+        View m_submit_screen_view {};
+        Rect m_view_rect {};    // Empty until a camera is set, which disables culling.
+
+        // Double-buffered when threaded: one queue is recorded while the other is submitted.
+        std::array<std::unique_ptr<DrawQueue>, 2> m_draw_queues;
+        std::array<std::unique_ptr<DrawQueue>, 2> m_screen_draw_queues;
+        std::size_t m_record_index { 0 };
+        std::size_t m_submit_index { 0 };
+
+        // Declared last to be destroyed first, since it still references the queues.
+        std::unique_ptr<RenderThread> m_render_thread;
 
+        /**
+         * Views the recorded frame through a camera, culling sprites drawn from now on against its view.
+         */
+        void set_camera(const Camera& camera);
+
+        /**
+         * Starts recording a frame.
+         */
+        void begin_recording();
+
+        /**
+         * Submits the recorded frame, or hands it off to the render thread once the previous one is submitted.
+         */
+        void submit_recording();
+
+        /**
+         * Waits for the frame in flight and stops the render thread, if any.
+         *
+         * @note Must be called before the backend is destroyed.
+         */
+        void stop_render_thread();
+
+        /**
+         * Called on the recording thread, after any frame in flight has been submitted, except for creations when
+         * `supports_concurrent_uploads`.
+         */
+        [[nodiscard]] virtual Texture create_backend_texture(int width, int height, const void* rgba_pixels) = 0;
+        virtual void update_backend_texture(Texture texture, int x, int y, int width, int height, const void* rgba_pixels) = 0;
+        virtual void destroy_backend_texture(Texture texture) = 0;
+
+        /**
+         * Returns whether textures may be created while the render thread submits a frame, their pixels uploaded
+         * with that frame or the next, so that streaming assets in does not wait for the frame in flight.
+         */
+        [[nodiscard]] virtual bool supports_concurrent_uploads() const noexcept { return false; }
+
+        /**
+         * Called on the render thread when threaded, on the main thread otherwise.
+         */
         virtual void begin_frame() = 0;
         virtual void end_frame() = 0;
+
+        /**
+         * Called on the main thread when threaded, once the render thread has submitted a frame, for backends
+         * that may only present on the thread that created the window.
+         */
+        virtual void present_frame() {}
     };
-} // vn
\ No newline at end of file
+} // vn
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace vn {
+    struct AssetSettings {
+        // Path of an archive written by the asset-packer tool, opened at startup. Empty to not open one.
+        std::string archive_path;
+
+        // Threads reading and decoding assets in the background.
+        std::size_t loader_threads { 1 };
+
+        // Bytes of decoded pixels uploaded per frame; at least one texture is uploaded per frame regardless.
+        std::size_t upload_budget { 8 << 20 };
+
+        // Source directories watched for edited files, which replace the textures loaded from them while the
+        // game runs. Textures loaded from the archive are matched by their path relative to these directories.
+        std::vector<std::string> watch_directories;
+    };
+} // vn
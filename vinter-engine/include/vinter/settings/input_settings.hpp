@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string>
+
+namespace vn {
+    struct InputSettings {
+        std::string record_path {}; // Records device input and frame deltas to this file, if set.
+        std::string replay_path {}; // Replays device input and frame deltas from this file instead, if set.
+        bool quit_on_replay_end { true };
+
+        // Bindings file loaded into the InputMap at startup, text or compiled (see InputMap::save_bindings), if set.
+        std::string bindings_path {};
+        bool watch_bindings { false }; // Reloads the bindings file whenever it changes, for editing it while the game runs.
+    };
+} // vn
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+
+namespace vn {
+    struct JobSettings {
+        // Worker threads besides the main thread, or 0 for one per remaining hardware core.
+        std::size_t worker_count { 0 };
+    };
+} // vn
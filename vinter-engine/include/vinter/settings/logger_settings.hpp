@@ -0,0 +1,11 @@
+#pragma once
+
+#include <string>
+
+namespace vn {
+    struct LoggerSettings {
+        // Moves formatting-free message output off the calling threads onto a background thread.
+        bool async { false };
+        std::string file_path {}; // Empty to log to the console.
+    };
+} // vn
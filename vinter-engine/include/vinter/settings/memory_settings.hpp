@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+
+namespace vn {
+    struct MemorySettings {
+        // Initial size of the frame arena in bytes; it grows to fit the largest frame.
+        std::size_t frame_arena_size { 1 << 20 };
+    };
+} // vn
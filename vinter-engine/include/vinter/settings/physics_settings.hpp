@@ -1,7 +1,21 @@
 #pragma once
 
+#include <glm/glm.hpp>
+
 namespace vn {
+    // The physics world steps with `fixed_update`, so it only runs with `TimeSettings::fixed_timestep` enabled.
     struct PhysicsSettings {
+        // Acceleration of every dynamic body in world units per second squared, y pointing down.
+        glm::vec2 gravity { 0.f, 980.f };
+
+        // Side of the broadphase grid cells in world units, best around the size of a typical collider.
+        float cell_size { 64.f };
+
+        // Velocity solver passes per step; more passes settle stacks and piles better, at a higher cost.
+        int iterations { 8 };
 
+        // Fraction of the penetration beyond `penetration_slop` pushed apart per step.
+        float position_correction { 0.8f };
+        float penetration_slop { 0.5f };
     };
-} // vn
\ No newline at end of file
+} // vn
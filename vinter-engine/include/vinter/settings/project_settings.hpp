@@ -3,11 +3,23 @@
 #include "vinter/settings/window_settings.hpp"
 #include "vinter/settings/renderer_settings.hpp"
 #include "vinter/settings/physics_settings.hpp"
+#include "vinter/settings/time_settings.hpp"
+#include "vinter/settings/logger_settings.hpp"
+#include "vinter/settings/input_settings.hpp"
+#include "vinter/settings/job_settings.hpp"
+#include "vinter/settings/memory_settings.hpp"
+#include "vinter/settings/asset_settings.hpp"
 
 namespace vn {
     struct ProjectSettings {
         WindowSettings window;
         RendererSettings renderer;
         PhysicsSettings physics;
+        TimeSettings time;
+        LoggerSettings logger;
+        InputSettings input;
+        JobSettings jobs;
+        MemorySettings memory;
+        AssetSettings assets;
     };
 } // vn
\ No newline at end of file
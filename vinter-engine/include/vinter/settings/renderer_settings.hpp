@@ -5,6 +5,7 @@ namespace vn {
         enum class Backend {
             SDL,
             SDL_GPU,
+            Null, // Draws nothing, see WindowSettings::headless.
         };
         Backend backend { Backend::SDL };
 
@@ -14,5 +15,13 @@ namespace vn {
             Adaptive,
         };
         VSyncMode vsync_mode { VSyncMode::Disabled };
+
+        // Record and submit each frame's GPU commands on a dedicated render thread while the next one is
+        // simulated, at the cost of one frame of latency. SDL only allows acquiring the swapchain and presenting
+        // on the thread that created the window, so with SDL_GPU the render thread draws into an offscreen
+        // target which the main thread copies to the swapchain and presents before handing off the next frame,
+        // one more frame later. Ignored with a warning for the SDL backend, whose renderer only runs on the main
+        // thread. Opt-in.
+        bool threaded { false };
     };
 } // vn
\ No newline at end of file
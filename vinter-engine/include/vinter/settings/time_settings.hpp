@@ -0,0 +1,12 @@
+#pragma once
+
+namespace vn {
+    struct TimeSettings {
+        // Runs `fixed_update` at a constant rate, decoupled from the frame rate.
+        bool fixed_timestep { false };
+        float fixed_delta { 1.f / 60.f };
+
+        // Caps the catch-up steps per frame; any backlog beyond it is dropped to avoid a spiral of death.
+        int max_fixed_steps { 8 };
+    };
+} // vn
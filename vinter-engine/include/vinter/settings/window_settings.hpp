@@ -12,6 +12,10 @@ namespace vn {
         Size initial_size { 1280, 720 };
         Size virtual_size { 640,  360 };
 
+        // Scales the virtual resolution to the window by whole multiples only, letterboxing the rest, so
+        // pixel art stays crisp. Windows smaller than the virtual size are scaled down regardless.
+        bool integer_scaling { true };
+
         struct Flags {
             bool
             fullscreen          { false },
@@ -29,5 +33,9 @@ namespace vn {
             high_pixel_density  { false };
         };
         Flags flags {};
+
+        // Runs without a display or audio device (SDL's offscreen video and dummy audio drivers) and with
+        // the null renderer backend, e.g. for CI and benchmarks.
+        bool headless { false };
     };
 } // vn
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace vn {
+    /**
+     * Packs rectangles into a fixed-size area with the skyline bottom-left heuristic.
+     *
+     * The packer tracks the top edge of the packed area as a list of horizontal segments, and places
+     * every rectangle where its top ends up lowest, preferring the tightest fitting segment on ties.
+     * It only keeps the skyline, so packing is fast enough to run at load time, and as good as offline
+     * packers for the similarly sized images of sprite sheets, especially when inserted tallest first.
+     */
+    class SkylinePacker {
+    public:
+        SkylinePacker(int width, int height);
+
+        /**
+         * Finds room for a rectangle and marks it as used.
+         *
+         * @return The top-left corner of the placed rectangle, or `std::nullopt` if it does not fit.
+         */
+        [[nodiscard]] std::optional<glm::ivec2> insert(int width, int height);
+
+        void clear();
+
+        [[nodiscard]] int get_width() const noexcept { return m_width; }
+        [[nodiscard]] int get_height() const noexcept { return m_height; }
+
+        /**
+         * Returns the fraction of the area covered by inserted rectangles.
+         */
+        [[nodiscard]] float get_occupancy() const noexcept;
+
+    private:
+        struct Segment {
+            int x, y, width;
+        };
+
+        int m_width, m_height;
+        std::size_t m_used_area { 0 };
+        std::vector<Segment> m_skyline; // Ordered by x, covering the full width.
+
+        /**
+         * Returns the lowest y at which a rectangle starting at segment `index` fits, if any.
+         */
+        [[nodiscard]] std::optional<int> fit(std::size_t index, int width, int height) const;
+    };
+} // vn
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+#include "vinter/color.hpp"
+#include "vinter/rect.hpp"
+#include "vinter/texture.hpp"
+
+namespace vn {
+    /**
+     * Describes a single textured quad to be drawn for the current frame.
+     *
+     * Sprites are drawn in ascending layer order. Sprites sharing a layer are grouped by texture,
+     * so their relative order is only preserved when they share the same texture.
+     */
+    struct Sprite {
+        Texture texture {};
+        Rect source {};             // Texture region in pixels, empty for the whole texture.
+        glm::vec2 position {};
+        glm::vec2 size {};          // Zero to use the source size.
+        glm::vec2 origin {};        // Pivot of scaling and rotation, relative to the top-left corner.
+        float rotation { 0.f };     // Radians, clockwise.
+        Color tint { colors::White };
+        std::int32_t layer { 0 };
+    };
+} // vn
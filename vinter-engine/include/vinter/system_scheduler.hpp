@@ -0,0 +1,126 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <entt/entity/registry.hpp>
+
+namespace vn {
+    class JobSystem;
+
+    /**
+     * Declares the components a system only reads.
+     */
+    template<typename... Components>
+    struct Read {};
+
+    /**
+     * Declares the components a system reads and writes.
+     */
+    template<typename... Components>
+    struct Write {};
+
+    /**
+     * Declares that a system needs the whole registry to itself, e.g. to create or destroy entities,
+     * add or remove components, or touch components it cannot name upfront.
+     */
+    struct Exclusive {};
+
+    /**
+     * Runs the systems of a registry once per frame, in parallel wherever their component access allows.
+     *
+     * Every system declares which components it reads and writes. Two systems conflict when one writes a
+     * component the other reads or writes, and conflicting systems always run in the order they were added;
+     * all others run concurrently on the JobSystem's workers.
+     *
+     * Typical usage:
+     * @code{.cpp}
+     * systems->add_system<Read<Velocity>, Write<Position>>("Movement", [](entt::registry& registry, float delta) {
+     *     for (auto [entity, position, velocity] : registry.view<Position, const Velocity>().each()) {
+     *         position.value += velocity.value * delta;
+     *     }
+     * });
+     * systems->add_system<Read<Position>, Write<Sprite>>("Animation", animate); // Runs after "Movement".
+     * systems->add_system<Write<Health>>("Regeneration", regenerate);           // Runs alongside both.
+     * systems->add_system<Exclusive>("Despawn", despawn);                       // Runs alone, after all of the above.
+     * @endcode
+     *
+     * @note Systems must only access the components they declare. The storage of every declared component
+     * is created when the system is added, so concurrent views never modify the registry itself.
+     */
+    class SystemScheduler {
+    public:
+        using SystemFunction = std::function<void(entt::registry& registry, float delta)>;
+
+        SystemScheduler(entt::registry& registry, JobSystem& jobs);
+        ~SystemScheduler();
+
+        SystemScheduler(const SystemScheduler&) = delete;
+        SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+        /**
+         * Adds a system to run every frame after the systems added before it that it conflicts with.
+         *
+         * @tparam Access Any number of `Read<...>`, `Write<...>` and `Exclusive` declarations.
+         * @param name The system's name in profiler zones, which must outlive the scheduler (string literal).
+         * @param function The callable to invoke with the registry and the frame's delta time.
+         */
+        template<typename... Access>
+        void add_system(const char* name, SystemFunction function) {
+            SystemAccess access;
+            (add_access(access, Access {}), ...);
+            add_system(name, std::move(access), std::move(function));
+        }
+
+        [[nodiscard]] std::size_t get_system_count() const noexcept;
+
+    private:
+        friend class Engine;
+
+        struct ComponentAccess {
+            entt::id_type id;
+            void (*assure)(entt::registry& registry);
+        };
+
+        struct SystemAccess {
+            std::vector<ComponentAccess> reads;
+            std::vector<ComponentAccess> writes;
+            bool exclusive { false };
+        };
+
+        template<typename Component>
+        static ComponentAccess make_access() {
+            using Type = std::remove_cv_t<Component>;
+            return {
+                entt::type_hash<Type>::value(),
+                [](entt::registry& registry) { static_cast<void>(registry.storage<Type>()); }
+            };
+        }
+
+        template<typename... Components>
+        static void add_access(SystemAccess& access, Read<Components...>) {
+            (access.reads.push_back(make_access<Components>()), ...);
+        }
+
+        template<typename... Components>
+        static void add_access(SystemAccess& access, Write<Components...>) {
+            (access.writes.push_back(make_access<Components>()), ...);
+        }
+
+        static void add_access(SystemAccess& access, Exclusive) {
+            access.exclusive = true;
+        }
+
+        void add_system(const char* name, SystemAccess access, SystemFunction function);
+
+        /**
+         * Runs every system once and waits for all of them to finish.
+         */
+        void run(float delta);
+
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+    };
+} // vn
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+
+#include <glm/glm.hpp>
+
+#include "vinter/color.hpp"
+
+namespace vn {
+    class Renderer;
+
+    /**
+     * A lightweight handle to a font loaded at a specific size.
+     */
+    struct FontHandle {
+        static constexpr std::uint32_t InvalidIndex { 0xFFFFFFFF };
+
+        std::uint32_t index { InvalidIndex };
+
+        [[nodiscard]] constexpr bool is_valid() const noexcept { return index != InvalidIndex; }
+        constexpr bool operator==(const FontHandle&) const = default;
+    };
+
+    /**
+     * Draws UTF-8 text through the renderer's batched quad path.
+     *
+     * Glyphs are rasterized once per font and size into a shared atlas texture, on first use, and the
+     * glyphs rasterized during a frame are uploaded together before it is submitted. The atlas
+     * is divided into rows of glyphs of a single font; when it is full, the least recently used row that
+     * was not drawn this frame is evicted and reused. Laid out strings are cached as ready-made quads,
+     * so drawing an unchanged string again is a lookup and a copy, regardless of its length. Cached
+     * layouts that go unused for a while are dropped.
+     *
+     * Typical usage:
+     * @code{.cpp}
+     * const FontHandle hud_font = text->load_font("assets/fonts/hud.ttf", 18.f);
+     *
+     * text->draw_text(hud_font, "Score: " + std::to_string(score), { 16.f, 16.f }, colors::Yellow);
+     * @endcode
+     *
+     * @note Text is drawn in screen space, over the world and unaffected by the camera: `position` is in virtual
+     * units from the top-left corner of the letterboxed viewport. It is drawn with the font's line top at
+     * `position`, and `\n` starts a new line.
+     */
+    class TextRenderer {
+        friend class Engine;
+
+    public:
+        static constexpr int DefaultAtlasSize { 1024 };
+
+        explicit TextRenderer(Renderer& renderer, int atlas_size = DefaultAtlasSize);
+        ~TextRenderer();
+
+        TextRenderer(const TextRenderer&) = delete;
+        TextRenderer& operator=(const TextRenderer&) = delete;
+
+        /**
+         * Loads a TrueType font file at the given point size.
+         *
+         * @return The font's handle, or an invalid handle on failure.
+         */
+        [[nodiscard]] FontHandle load_font(std::string_view path, float size);
+
+        /**
+         * Loads a TrueType font from memory, such as a file of an AssetArchive, at the given point size.
+         *
+         * @return The font's handle, or an invalid handle on failure.
+         * @note The font reads glyphs from `data` as they are first drawn, so it must outlive the text renderer.
+         */
+        [[nodiscard]] FontHandle load_font(std::span<const std::byte> data, float size);
+
+        /**
+         * Queues a string to be drawn at the end of the current frame.
+         *
+         * @param font The font to draw with.
+         * @param text The UTF-8 text to draw.
+         * @param position The top-left corner of the first line, in screen space.
+         * @param color The color of the text.
+         * @param layer The layer to draw in among the screen space quads, like Sprite::layer.
+         */
+        void draw_text(FontHandle font, std::string_view text, glm::vec2 position,
+                       Color color = colors::White, std::int32_t layer = 0);
+
+        /**
+         * Returns the size of the laid out text, the width of its longest line by the height of all lines.
+         */
+        [[nodiscard]] glm::vec2 measure_text(FontHandle font, std::string_view text);
+
+        /**
+         * Returns the distance between the tops of two consecutive lines.
+         */
+        [[nodiscard]] float get_line_height(FontHandle font) const;
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+
+        /**
+         * Advances the frame used to track glyph and layout use.
+         */
+        void begin_frame();
+
+        /**
+         * Uploads the atlas region holding the glyphs rasterized since the last upload, before the frame is submitted.
+         */
+        void end_frame();
+    };
+} // vn
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+namespace vn {
+    /**
+     * The renderer-specific identifier of a texture. Zero never refers to a valid texture.
+     */
+    using TextureID = std::uint32_t;
+
+    /**
+     * A lightweight, copyable reference to a texture owned by the Renderer.
+     *
+     * @note A default constructed Texture is "no texture"; drawing with it produces solid colored geometry.
+     */
+    struct Texture {
+        TextureID id { 0 };
+        int width { 0 }, height { 0 };
+
+        [[nodiscard]] constexpr bool is_valid() const noexcept { return id != 0; }
+    };
+} // vn
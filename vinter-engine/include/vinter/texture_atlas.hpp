@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "vinter/rect.hpp"
+#include "vinter/skyline_packer.hpp"
+#include "vinter/texture.hpp"
+
+namespace vn {
+    class Renderer;
+
+    /**
+     * A lightweight handle to an image packed into a TextureAtlas.
+     */
+    struct AtlasHandle {
+        static constexpr std::uint32_t InvalidIndex { 0xFFFFFFFF };
+
+        std::uint32_t index { InvalidIndex };
+
+        [[nodiscard]] constexpr bool is_valid() const noexcept { return index != InvalidIndex; }
+        constexpr bool operator==(const AtlasHandle&) const = default;
+    };
+
+    /**
+     * Where a packed image lives: the atlas page texture and the image's pixel rect within it.
+     */
+    struct AtlasRegion {
+        Texture texture {};
+        Rect source {};
+    };
+
+    /**
+     * Packs images into a few large texture pages, so sprites from many images share a texture and
+     * the renderer draws them in a single batch.
+     *
+     * Images are placed with a SkylinePacker, surrounded by `padding` pixels that repeat their edges,
+     * so that filtering never samples a neighbouring image. Images larger than a page get a page of
+     * their own. Loaded files are cached by path, so loading the same file again is a lookup.
+     *
+     * Typical usage:
+     * @code{.cpp}
+     * TextureAtlas atlas { *renderer };
+     * const AtlasHandle player = atlas.load("assets/player.png");
+     *
+     * const AtlasRegion& region = atlas.get_region(player);
+     * renderer->draw_sprite({ .texture = region.texture, .source = region.source, .position = position });
+     * @endcode
+     *
+     * @note The renderer must outlive the atlas, which destroys its pages.
+     */
+    class TextureAtlas {
+    public:
+        static constexpr int DefaultPageSize { 2048 };
+
+        explicit TextureAtlas(Renderer& renderer, int page_size = DefaultPageSize, int padding = 1);
+        ~TextureAtlas();
+
+        TextureAtlas(const TextureAtlas&) = delete;
+        TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+        /**
+         * Loads an image file (BMP or PNG) into the atlas, or returns the handle of the already loaded file.
+         *
+         * @return The image's handle, or an invalid handle on failure.
+         */
+        [[nodiscard]] AtlasHandle load(std::string_view path);
+
+        /**
+         * Decodes an image file (BMP or PNG) already in memory into the atlas, cached under `name` like a
+         * loaded path, or returns the handle of the image already loaded under that name.
+         *
+         * @return The image's handle, or an invalid handle on failure.
+         */
+        [[nodiscard]] AtlasHandle load(std::string_view name, std::span<const std::byte> data);
+
+        /**
+         * Loads several image files at once, packing them tallest first for a tighter fit.
+         *
+         * @return The handles of the images, in the order of `paths`.
+         */
+        [[nodiscard]] std::vector<AtlasHandle> load(std::span<const std::string_view> paths);
+
+        /**
+         * Packs tightly packed 8-bit RGBA pixels into the atlas.
+         *
+         * @return The image's handle, or an invalid handle on failure.
+         */
+        [[nodiscard]] AtlasHandle add(int width, int height, const void* rgba_pixels);
+
+        /**
+         * Returns the handle of a loaded file, or an invalid handle if it has not been loaded.
+         */
+        [[nodiscard]] AtlasHandle find(std::string_view path) const;
+
+        [[nodiscard]] const AtlasRegion& get_region(AtlasHandle handle) const;
+
+        [[nodiscard]] std::size_t get_page_count() const noexcept { return m_pages.size(); }
+        [[nodiscard]] Texture get_page_texture(std::size_t page) const { return m_pages[page].texture; }
+
+    private:
+        struct Page {
+            Texture texture;
+            SkylinePacker packer;
+        };
+
+        Renderer& m_renderer;
+        int m_page_size;
+        int m_padding;
+
+        std::vector<Page> m_pages;
+        std::vector<AtlasRegion> m_regions;
+        std::unordered_multimap<std::uint64_t, AtlasHandle> m_path_lookup; // Keyed by path hash, colliding paths included.
+        std::vector<std::string> m_region_paths; // Indexed like m_regions, empty for images added from pixels.
+
+        /**
+         * Returns the page and position of a free area of the given size, adding a page if none has room.
+         */
+        bool allocate(int width, int height, std::size_t& page, glm::ivec2& position);
+
+        /**
+         * Caches a loaded image under its path, for `find`.
+         */
+        void add_path(std::string_view path, AtlasHandle handle);
+    };
+} // vn
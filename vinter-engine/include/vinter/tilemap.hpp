@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "vinter/color.hpp"
+#include "vinter/rect.hpp"
+#include "vinter/texture.hpp"
+#include "vinter/vertex.hpp"
+
+namespace vn {
+    class Renderer;
+
+    /**
+     * The index of a tile in a Tileset, counting rows left to right from 1. Zero is an empty tile.
+     */
+    using TileID = std::uint16_t;
+
+    /**
+     * A grid of equally sized tiles within a texture.
+     */
+    struct Tileset {
+        Texture texture {};
+        Rect region {};                 // Area of the texture holding the tiles, empty for the whole texture.
+        glm::ivec2 tile_size { 16 };    // In texture pixels.
+    };
+
+    /**
+     * A grid of tiles drawn from cached per-chunk geometry.
+     *
+     * The map is split into chunks of ChunkSize x ChunkSize tiles. Each chunk's quads are built once and
+     * only rebuilt after one of its tiles changes, and only when the chunk is about to be drawn. Drawing
+     * submits the cached geometry of the chunks overlapping the view, without touching individual tiles.
+     *
+     * Typical usage:
+     * @code{.cpp}
+     * Tilemap level { 512, 512, tileset, { 32.f, 32.f } };
+     * level.set_tile(x, y, Wall);
+     *
+     * level.set_tile(x, y, Floor); // A bomb destroyed a wall, only its chunk is rebuilt.
+     * level.draw(*renderer, camera->get_view_rect());
+     * @endcode
+     */
+    class Tilemap {
+    public:
+        // Tiles per chunk side.
+        static constexpr int ChunkSize { 32 };
+
+        /**
+         * @param width The width of the map in tiles.
+         * @param height The height of the map in tiles.
+         * @param tileset The tileset that tile IDs index into.
+         * @param tile_size The size of a tile in world units.
+         */
+        Tilemap(int width, int height, const Tileset& tileset, glm::vec2 tile_size);
+
+        [[nodiscard]] int get_width() const noexcept { return m_width; }
+        [[nodiscard]] int get_height() const noexcept { return m_height; }
+
+        /**
+         * Returns the tile at the given coordinates, or the empty tile if they are out of bounds.
+         */
+        [[nodiscard]] TileID get_tile(int x, int y) const noexcept;
+
+        /**
+         * Sets the tile at the given coordinates and marks its chunk for rebuilding.
+         */
+        void set_tile(int x, int y, TileID tile) noexcept;
+
+        void fill(TileID tile) noexcept;
+
+        void set_tileset(const Tileset& tileset) noexcept;
+        [[nodiscard]] const Tileset& get_tileset() const noexcept { return m_tileset; }
+
+        /**
+         * Returns the tile coordinates containing a world position, which may be out of bounds.
+         */
+        [[nodiscard]] glm::ivec2 world_to_tile(glm::vec2 world_position) const noexcept;
+
+        /**
+         * Queues the chunks overlapping `view`, rebuilding those that changed since they were last drawn.
+         *
+         * @param renderer The renderer to draw with.
+         * @param view The visible area in world units.
+         */
+        void draw(Renderer& renderer, const Rect& view);
+
+        glm::vec2 position {};   // World position of the top-left corner.
+        Color tint { colors::White };
+        std::int32_t layer { 0 };
+
+    private:
+        struct Chunk {
+            std::vector<Vertex> vertices;
+            bool dirty { true };
+        };
+
+        int m_width, m_height;
+        int m_chunk_columns, m_chunk_rows;
+        Tileset m_tileset;
+        glm::vec2 m_tile_size;
+
+        std::vector<TileID> m_tiles;   // Row-major.
+        std::vector<Chunk> m_chunks;   // Row-major.
+
+        // The position and tint baked into the chunk geometry, which is rebuilt when they change.
+        glm::vec2 m_built_position {};
+        glm::vec4 m_built_color { 1.f };
+
+        void mark_all_dirty() noexcept;
+
+        void build_chunk(int chunk_x, int chunk_y);
+    };
+} // vn
@@ -2,22 +2,50 @@
 
 #include <cstdint>
 
+#include "vinter/settings/time_settings.hpp"
+
 namespace vn {
     class Time {
         friend class Engine;
 
     public:
-        Time();
+        explicit Time(const TimeSettings& time_settings = {});
 
         [[nodiscard]] float get_delta() const;
         [[nodiscard]] float get_fps() const;
 
+        [[nodiscard]] bool is_fixed_timestep() const;
+        [[nodiscard]] float get_fixed_delta() const;
+
+        /**
+         * Returns how far the current frame lies between the last and the next fixed step, in the range [0, 1).
+         *
+         * Rendering code should interpolate simulated state by this factor, e.g.
+         * `glm::mix(previous_position, current_position, time->get_interpolation_alpha())`.
+         * Always 1 when the fixed timestep is disabled.
+         */
+        [[nodiscard]] float get_interpolation_alpha() const;
+
     private:
-        void update();
+        /**
+         * Measures the real time elapsed since the previous measurement.
+         */
+        [[nodiscard]] float measure_delta();
+
+        /**
+         * Starts a new frame of the given duration, which is usually but not always the measured delta.
+         */
+        void advance(float delta);
+        [[nodiscard]] bool consume_fixed_step();
+
+        TimeSettings m_settings;
 
         std::uint64_t m_tick_previous { 0 };
         std::uint64_t m_tick_current { 0 };
         std::uint64_t m_frequency { 0 };
         float m_delta { 0.f };
+
+        double m_accumulator { 0.0 };
+        int m_fixed_steps { 0 };
     };
-} // vn
\ No newline at end of file
+} // vn
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace vn {
+    /**
+     * The positions, rotations and scales of many instances of one sprite, each stored in its own array.
+     *
+     * Keeping every component contiguous lets systems update all transforms in tight loops, and lets the
+     * renderer expand the whole batch into quads with SIMD kernels (SSE2, AVX2 or NEON, picked at runtime)
+     * instead of one sprite at a time. See `Renderer::draw_sprites`.
+     *
+     * Typical usage:
+     * @code{.cpp}
+     * TransformBatch bullets;
+     * bullets.add(muzzle_position, angle);
+     *
+     * const auto xs = bullets.get_positions_x();
+     * const auto ys = bullets.get_positions_y();
+     * for (std::size_t i = 0; i < bullets.get_count(); ++i) {
+     *     xs[i] += speed_x[i] * delta;
+     *     ys[i] += speed_y[i] * delta;
+     * }
+     * renderer->draw_sprites({ .texture = bullet_texture, .origin = { 4.f, 4.f } }, bullets);
+     * @endcode
+     */
+    class TransformBatch {
+    public:
+        /**
+         * Appends a transform.
+         *
+         * @param position The world position of the instance's origin.
+         * @param rotation Radians, clockwise.
+         * @param scale The scale of the instance's size, around its origin.
+         * @return The index of the transform.
+         */
+        std::size_t add(glm::vec2 position, float rotation = 0.f, glm::vec2 scale = glm::vec2 { 1.f });
+
+        /**
+         * Removes a transform by moving the last one into its place.
+         */
+        void remove(std::size_t index);
+
+        void reserve(std::size_t count);
+        void clear() noexcept;
+
+        [[nodiscard]] std::size_t get_count() const noexcept { return m_positions_x.size(); }
+        [[nodiscard]] bool is_empty() const noexcept { return m_positions_x.empty(); }
+
+        [[nodiscard]] glm::vec2 get_position(const std::size_t index) const { return { m_positions_x[index], m_positions_y[index] }; }
+        [[nodiscard]] float get_rotation(const std::size_t index) const { return m_rotations[index]; }
+        [[nodiscard]] glm::vec2 get_scale(const std::size_t index) const { return { m_scales_x[index], m_scales_y[index] }; }
+
+        void set_position(std::size_t index, glm::vec2 position);
+        void set_rotation(const std::size_t index, const float rotation) { m_rotations[index] = rotation; }
+        void set_scale(std::size_t index, glm::vec2 scale);
+
+        /**
+         * The component arrays, for updating every transform in one pass.
+         */
+        [[nodiscard]] std::span<float> get_positions_x() noexcept { return m_positions_x; }
+        [[nodiscard]] std::span<float> get_positions_y() noexcept { return m_positions_y; }
+        [[nodiscard]] std::span<float> get_rotations() noexcept { return m_rotations; }
+        [[nodiscard]] std::span<float> get_scales_x() noexcept { return m_scales_x; }
+        [[nodiscard]] std::span<float> get_scales_y() noexcept { return m_scales_y; }
+
+        [[nodiscard]] std::span<const float> get_positions_x() const noexcept { return m_positions_x; }
+        [[nodiscard]] std::span<const float> get_positions_y() const noexcept { return m_positions_y; }
+        [[nodiscard]] std::span<const float> get_rotations() const noexcept { return m_rotations; }
+        [[nodiscard]] std::span<const float> get_scales_x() const noexcept { return m_scales_x; }
+        [[nodiscard]] std::span<const float> get_scales_y() const noexcept { return m_scales_y; }
+
+    private:
+        std::vector<float> m_positions_x, m_positions_y;
+        std::vector<float> m_rotations;
+        std::vector<float> m_scales_x, m_scales_y;
+    };
+} // vn
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace vn {
+    /**
+     * The vertex layout submitted to the renderer backends.
+     *
+     * @note Layout matches SDL_Vertex (position, float color, texture coordinate).
+     */
+    struct Vertex {
+        glm::vec2 position {};
+        glm::vec4 color { 1.f };
+        glm::vec2 uv {};
+    };
+} // vn
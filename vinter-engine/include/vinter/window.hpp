@@ -16,6 +16,12 @@ namespace vn {
 
         [[nodiscard]] SDL_Window* get_native_handle() const;
 
+        /**
+         * Returns the size of the window's drawable area in pixels, kept up to date on resize.
+         */
+        [[nodiscard]] int get_width() const noexcept { return m_width; }
+        [[nodiscard]] int get_height() const noexcept { return m_height; }
+
     private:
         int m_width { 0 }, m_height { 0 };
 
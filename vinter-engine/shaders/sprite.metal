@@ -0,0 +1,42 @@
+#include <metal_stdlib>
+
+using namespace metal;
+
+struct VertexInput {
+    float2 corner  [[attribute(0)]];
+    float4 rect    [[attribute(1)]];
+    float4 pivot   [[attribute(2)]];
+    float4 uv_rect [[attribute(3)]];
+    float4 color   [[attribute(4)]];
+};
+
+struct VertexOutput {
+    float4 position [[position]];
+    float2 uv;
+    float4 color;
+};
+
+struct ViewUniforms {
+    float4 view; // World to clip space scale (xy) and offset (zw).
+};
+
+vertex VertexOutput sprite_vertex(VertexInput in [[stage_in]], constant ViewUniforms& u [[buffer(0)]]) {
+    float2 local = in.corner * in.rect.zw - in.pivot.xy;
+    float c = cos(in.pivot.z);
+    float s = sin(in.pivot.z);
+    float2 world = in.rect.xy + float2(local.x * c - local.y * s, local.x * s + local.y * c);
+
+    VertexOutput out;
+    out.position = float4(world * u.view.xy + u.view.zw, 0.0, 1.0);
+    out.uv = mix(in.uv_rect.xy, in.uv_rect.zw, in.corner);
+    out.color = in.color;
+    return out;
+}
+
+fragment float4 sprite_fragment(
+    VertexOutput in [[stage_in]],
+    texture2d<float> sprite_texture [[texture(0)]],
+    sampler sprite_sampler [[sampler(0)]]
+) {
+    return sprite_texture.sample(sprite_sampler, in.uv) * in.color;
+}
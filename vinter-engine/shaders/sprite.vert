@@ -0,0 +1,28 @@
+#version 450
+
+// Unit quad corner, per vertex.
+layout(location = 0) in vec2 in_corner;
+
+// Sprite instance, see DrawQueue::Instance.
+layout(location = 1) in vec4 in_rect;
+layout(location = 2) in vec4 in_pivot;
+layout(location = 3) in vec4 in_uv_rect;
+layout(location = 4) in vec4 in_color;
+
+layout(location = 0) out vec2 out_uv;
+layout(location = 1) out vec4 out_color;
+
+layout(set = 1, binding = 0) uniform ViewUniforms {
+    vec4 u_view; // World to clip space scale (xy) and offset (zw).
+};
+
+void main() {
+    vec2 local = in_corner * in_rect.zw - in_pivot.xy;
+    float c = cos(in_pivot.z);
+    float s = sin(in_pivot.z);
+    vec2 world = in_rect.xy + vec2(local.x * c - local.y * s, local.x * s + local.y * c);
+
+    gl_Position = vec4(world * u_view.xy + u_view.zw, 0.0, 1.0);
+    out_uv = mix(in_uv_rect.xy, in_uv_rect.zw, in_corner);
+    out_color = in_color;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+namespace vn::archive {
+    // The archive is read in place through a memory map, so its integers are stored in the host's order.
+    static_assert(std::endian::native == std::endian::little, "Asset archives are little-endian.");
+
+    constexpr std::array<char, 4> Magic { 'V', 'P', 'A', 'K' };
+    constexpr std::uint32_t Version { 1 };
+
+    // Entry data starts on cache line boundaries, which also suits any SIMD or GPU upload of it.
+    constexpr std::uint64_t Alignment { 64 };
+
+    /**
+     * At offset 0. Entry data follows from the first aligned offset, then the table of contents, then
+     * the names of the entries.
+     */
+    struct Header {
+        std::array<char, 4> magic;
+        std::uint32_t version;
+        std::uint32_t entry_count;
+        std::uint32_t reserved;
+        std::uint64_t toc_offset;
+        std::uint64_t names_offset;
+        std::uint64_t names_size;
+    };
+
+    /**
+     * Sorted by path hash, then by name, for binary search.
+     */
+    struct TocEntry {
+        std::uint64_t path_hash;    // fnv1a_64 of the path.
+        std::uint64_t offset;
+        std::uint64_t size;
+        std::uint32_t name_offset;  // Into the names block.
+        std::uint32_t name_size;
+    };
+
+    static_assert(sizeof(Header) == 40);
+    static_assert(sizeof(TocEntry) == 32);
+} // vn::archive
@@ -0,0 +1,178 @@
+#include "vinter/assets/archive_writer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <ranges>
+#include <unordered_set>
+
+#include "vinter/logger.hpp"
+#include "vinter/utils/hash.hpp"
+#include "archive_format.hpp"
+
+namespace vn {
+    namespace {
+        bool write_bytes(std::ofstream& file, const void* data, const std::size_t size) {
+            file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+            return static_cast<bool>(file);
+        }
+
+        bool pad_to(std::ofstream& file, const std::uint64_t offset) {
+            constexpr std::array<char, archive::Alignment> Zeros {};
+            const auto position = static_cast<std::uint64_t>(file.tellp());
+            return write_bytes(file, Zeros.data(), offset - position);
+        }
+
+        constexpr std::uint64_t align_up(const std::uint64_t offset) noexcept {
+            return (offset + archive::Alignment - 1) & ~(archive::Alignment - 1);
+        }
+
+        /**
+         * Copies a source file into the archive in chunks.
+         */
+        bool copy_file(std::ofstream& file, const std::string& source_path, std::uint64_t& size) {
+            std::ifstream source { source_path, std::ios::binary };
+            if (!source) {
+                Logger::error("Failed to open file to pack: " + source_path);
+                return false;
+            }
+
+            std::array<char, 64 * 1024> buffer;
+            size = 0;
+            while (source) {
+                source.read(buffer.data(), buffer.size());
+                const auto read = static_cast<std::size_t>(source.gcount());
+                if (read > 0 && !write_bytes(file, buffer.data(), read)) return false;
+                size += read;
+            }
+
+            if (!source.eof()) {
+                Logger::error("Failed to read file to pack: " + source_path);
+                return false;
+            }
+            return true;
+        }
+    }
+
+    void ArchiveWriter::add_file(const std::string_view path, const std::string_view source_path) {
+        m_entries.push_back({ normalize_path(path), std::string { source_path }, {} });
+    }
+
+    void ArchiveWriter::add(const std::string_view path, const std::span<const std::byte> data) {
+        m_entries.push_back({ normalize_path(path), {}, { data.begin(), data.end() } });
+    }
+
+    bool ArchiveWriter::write(const std::string_view output_path) const {
+        // The last entry added under a path replaces the earlier ones.
+        std::vector<const Entry*> entries;
+        std::unordered_set<std::string_view> paths;
+        entries.reserve(m_entries.size());
+        for (const Entry& entry : m_entries | std::views::reverse) {
+            if (!paths.insert(entry.path).second) {
+                Logger::warning("Duplicate path in archive, keeping the last one added: " + entry.path);
+                continue;
+            }
+            entries.push_back(&entry);
+        }
+        std::ranges::reverse(entries);
+
+        if (entries.size() > std::numeric_limits<std::uint32_t>::max()) {
+            Logger::error("Too many entries for an archive.");
+            return false;
+        }
+
+        // Written next to the target and renamed over it once complete, so that a failed write never leaves
+        // a partial archive behind, nor destroys the previous one.
+        const std::filesystem::path target { output_path };
+        std::filesystem::path temporary = target;
+        temporary += ".tmp";
+
+        std::ofstream file { temporary, std::ios::binary | std::ios::trunc };
+        if (!file) {
+            Logger::error("Failed to create archive: " + temporary.string());
+            return false;
+        }
+
+        const auto discard = [&] {
+            file.close();
+            std::error_code error;
+            std::filesystem::remove(temporary, error);
+            return false;
+        };
+
+        // Reserved for the header, written last once every offset is known.
+        archive::Header header {};
+        if (!write_bytes(file, &header, sizeof(header))) {
+            Logger::error("Failed to write archive: " + temporary.string());
+            return discard();
+        }
+
+        std::vector<archive::TocEntry> toc;
+        std::string names;
+        toc.reserve(entries.size());
+
+        for (const Entry* entry : entries) {
+            archive::TocEntry toc_entry {};
+            toc_entry.path_hash = fnv1a_64(entry->path);
+            toc_entry.offset = align_up(static_cast<std::uint64_t>(file.tellp()));
+            toc_entry.name_offset = static_cast<std::uint32_t>(names.size());
+            toc_entry.name_size = static_cast<std::uint32_t>(entry->path.size());
+            names += entry->path;
+
+            if (!pad_to(file, toc_entry.offset)) break;
+            if (entry->source_path.empty()) {
+                if (!write_bytes(file, entry->data.data(), entry->data.size())) break;
+                toc_entry.size = entry->data.size();
+            } else if (!copy_file(file, entry->source_path, toc_entry.size)) {
+                return discard();
+            }
+            toc.push_back(toc_entry);
+        }
+
+        if (toc.size() != entries.size() || names.size() > std::numeric_limits<std::uint32_t>::max()) {
+            Logger::error("Failed to write archive: " + temporary.string());
+            return discard();
+        }
+
+        std::ranges::sort(toc, [&](const archive::TocEntry& a, const archive::TocEntry& b) {
+            if (a.path_hash != b.path_hash) return a.path_hash < b.path_hash;
+            return std::string_view { names }.substr(a.name_offset, a.name_size)
+                 < std::string_view { names }.substr(b.name_offset, b.name_size);
+        });
+
+        header.magic = archive::Magic;
+        header.version = archive::Version;
+        header.entry_count = static_cast<std::uint32_t>(toc.size());
+        header.toc_offset = align_up(static_cast<std::uint64_t>(file.tellp()));
+        header.names_offset = header.toc_offset + toc.size() * sizeof(archive::TocEntry);
+        header.names_size = names.size();
+
+        const bool written = pad_to(file, header.toc_offset)
+            && write_bytes(file, toc.data(), toc.size() * sizeof(archive::TocEntry))
+            && write_bytes(file, names.data(), names.size())
+            && file.seekp(0)
+            && write_bytes(file, &header, sizeof(header));
+
+        file.close();
+        if (!written || !file) {
+            Logger::error("Failed to write archive: " + temporary.string());
+            return discard();
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporary, target, error);
+        if (error) {
+            Logger::error("Failed to replace archive " + target.string() + ": " + error.message());
+            return discard();
+        }
+        return true;
+    }
+
+    std::string ArchiveWriter::normalize_path(const std::string_view path) {
+        std::string normalized { path };
+        std::ranges::replace(normalized, '\\', '/');
+        return normalized;
+    }
+} // vn
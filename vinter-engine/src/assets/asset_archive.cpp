@@ -0,0 +1,220 @@
+#include "vinter/assets/asset_archive.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "vinter/logger.hpp"
+#include "vinter/utils/hash.hpp"
+#include "archive_format.hpp"
+
+namespace vn {
+    namespace {
+        /**
+         * A read-only view of a whole file, unmapped on destruction.
+         */
+        class MappedFile {
+        public:
+            MappedFile() = default;
+            ~MappedFile() { unmap(); }
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            bool map(const std::string& path) {
+                unmap();
+
+#ifdef _WIN32
+                const HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (file == INVALID_HANDLE_VALUE) return false;
+
+                LARGE_INTEGER file_size;
+                if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+                    CloseHandle(file);
+                    return false;
+                }
+
+                const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                CloseHandle(file);
+                if (!mapping) return false;
+
+                void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                // The view keeps the mapping alive.
+                CloseHandle(mapping);
+                if (!view) return false;
+
+                m_data = static_cast<const std::byte*>(view);
+                m_size = static_cast<std::size_t>(file_size.QuadPart);
+#else
+                const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+                if (file < 0) return false;
+
+                struct stat file_stat {};
+                if (fstat(file, &file_stat) != 0 || file_stat.st_size == 0) {
+                    ::close(file);
+                    return false;
+                }
+
+                const auto size = static_cast<std::size_t>(file_stat.st_size);
+                void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+                // The mapping keeps the file alive.
+                ::close(file);
+                if (view == MAP_FAILED) return false;
+
+                m_data = static_cast<const std::byte*>(view);
+                m_size = size;
+#endif
+                return true;
+            }
+
+            void unmap() noexcept {
+                if (!m_data) return;
+
+#ifdef _WIN32
+                UnmapViewOfFile(m_data);
+#else
+                munmap(const_cast<std::byte*>(m_data), m_size);
+#endif
+                m_data = nullptr;
+                m_size = 0;
+            }
+
+            [[nodiscard]] const std::byte* get_data() const noexcept { return m_data; }
+            [[nodiscard]] std::size_t get_size() const noexcept { return m_size; }
+
+        private:
+            const std::byte* m_data { nullptr };
+            std::size_t m_size { 0 };
+        };
+    }
+
+    struct AssetArchive::Impl {
+        MappedFile file;
+        std::span<const archive::TocEntry> toc;
+        std::string_view names;
+
+        [[nodiscard]] std::string_view get_name(const archive::TocEntry& entry) const noexcept {
+            return names.substr(entry.name_offset, entry.name_size);
+        }
+
+        /**
+         * Checks the header and that every entry lies within the file, so that lookups never need to.
+         */
+        bool validate(const std::string_view path) {
+            const std::byte* data = file.get_data();
+            const std::uint64_t size = file.get_size();
+
+            const auto fail = [&](const std::string_view reason) {
+                Logger::error("Invalid asset archive " + std::string { path } + ": " + std::string { reason });
+                return false;
+            };
+
+            if (size < sizeof(archive::Header)) return fail("truncated header");
+
+            archive::Header header;
+            std::memcpy(&header, data, sizeof(header));
+            if (header.magic != archive::Magic) return fail("not an asset archive");
+            if (header.version != archive::Version) return fail("unsupported version " + std::to_string(header.version));
+
+            const std::uint64_t toc_size = std::uint64_t { header.entry_count } * sizeof(archive::TocEntry);
+            if (header.toc_offset % alignof(archive::TocEntry) != 0
+                || header.toc_offset > size || toc_size > size - header.toc_offset) {
+                return fail("table of contents out of bounds");
+            }
+            if (header.names_offset > size || header.names_size > size - header.names_offset) {
+                return fail("names out of bounds");
+            }
+
+            // The map is page aligned and the offset checked above, so the entries can be read in place.
+            toc = { reinterpret_cast<const archive::TocEntry*>(data + header.toc_offset), header.entry_count };
+            names = { reinterpret_cast<const char*>(data + header.names_offset), header.names_size };
+
+            for (std::size_t i = 0; i < toc.size(); ++i) {
+                const archive::TocEntry& entry = toc[i];
+                if (entry.offset > size || entry.size > size - entry.offset) return fail("entry out of bounds");
+                if (entry.name_offset > names.size() || entry.name_size > names.size() - entry.name_offset) {
+                    return fail("entry name out of bounds");
+                }
+
+                // Lookups binary search the entries, which silently miss paths in an unsorted table.
+                if (i > 0) {
+                    const archive::TocEntry& previous = toc[i - 1];
+                    if (previous.path_hash > entry.path_hash
+                        || (previous.path_hash == entry.path_hash && get_name(previous) > get_name(entry))) {
+                        return fail("table of contents not sorted");
+                    }
+                }
+            }
+            return true;
+        }
+    };
+
+    AssetArchive::AssetArchive() : m_impl(std::make_unique<Impl>()) {}
+
+    AssetArchive::~AssetArchive() = default;
+
+    bool AssetArchive::open(const std::string_view path) {
+        close();
+
+        if (!m_impl->file.map(std::string { path })) {
+            Logger::error("Failed to map asset archive: " + std::string { path });
+            return false;
+        }
+
+        if (!m_impl->validate(path)) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void AssetArchive::close() {
+        m_impl->toc = {};
+        m_impl->names = {};
+        m_impl->file.unmap();
+    }
+
+    bool AssetArchive::is_open() const noexcept {
+        return m_impl->file.get_data() != nullptr;
+    }
+
+    std::span<const std::byte> AssetArchive::find(const std::string_view path) const noexcept {
+        const std::uint64_t hash = fnv1a_64(path);
+
+        const auto range = std::ranges::equal_range(m_impl->toc, hash, {}, &archive::TocEntry::path_hash);
+        for (const archive::TocEntry& entry : range) {
+            if (m_impl->get_name(entry) == path) {
+                return { m_impl->file.get_data() + entry.offset, entry.size };
+            }
+        }
+        return {};
+    }
+
+    bool AssetArchive::contains(const std::string_view path) const noexcept {
+        const std::uint64_t hash = fnv1a_64(path);
+
+        const auto range = std::ranges::equal_range(m_impl->toc, hash, {}, &archive::TocEntry::path_hash);
+        return std::ranges::any_of(range, [&](const archive::TocEntry& entry) { return m_impl->get_name(entry) == path; });
+    }
+
+    std::size_t AssetArchive::get_entry_count() const noexcept {
+        return m_impl->toc.size();
+    }
+
+    std::string_view AssetArchive::get_entry_path(const std::size_t index) const {
+        return m_impl->get_name(m_impl->toc[index]);
+    }
+} // vn
@@ -0,0 +1,295 @@
+#include "vinter/assets/asset_manager.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "vinter/settings/asset_settings.hpp"
+#include "vinter/assets/asset_archive.hpp"
+#include "vinter/renderer.hpp"
+#include "vinter/logger.hpp"
+#include "vinter/profiler.hpp"
+#include "vinter/utils/hash.hpp"
+#include "../renderer/image.hpp"
+
+namespace vn {
+    struct AssetManager::Impl {
+        struct Slot {
+            std::string path;
+            std::uint32_t generation { 0 };
+            std::uint32_t references { 0 };
+            std::uint32_t serial { 0 };     // Of the latest request, results of earlier ones are stale.
+            AssetState state { AssetState::Unloaded };
+            Texture texture {};
+        };
+
+        struct Request {
+            TextureAsset asset;
+            std::uint32_t serial;
+            std::string path;
+            bool from_archive;      // Reloads always read from disk, the archive is not rebuilt on the fly.
+        };
+
+        struct Decoded {
+            TextureAsset asset;
+            std::uint32_t serial;
+            bool loaded;
+            Image image;
+        };
+
+        Renderer& renderer;
+        const AssetArchive& archive;
+        std::size_t upload_budget;
+
+        // Main thread only.
+        std::vector<Slot> slots;
+        std::vector<std::uint32_t> free_slots;
+        std::unordered_multimap<std::uint64_t, std::uint32_t> path_lookup; // Keyed by path hash, colliding paths included.
+        std::vector<Texture> released_textures;
+        std::size_t pending_count { 0 };
+
+        // Shared with the loader threads.
+        std::mutex mutex;
+        std::condition_variable requested;
+        std::deque<Request> requests;
+        std::vector<Decoded> decoded;
+        bool stopping { false };
+
+        std::vector<std::thread> loaders;
+
+        Impl(Renderer& renderer, const AssetArchive& archive, const AssetSettings& asset_settings)
+            : renderer(renderer), archive(archive), upload_budget(asset_settings.upload_budget) {
+            const std::size_t loader_count = std::max<std::size_t>(1, asset_settings.loader_threads);
+            for (std::size_t i = 0; i < loader_count; ++i) {
+                loaders.emplace_back([this, i] { run_loader(i); });
+            }
+        }
+
+        ~Impl() {
+            {
+                std::lock_guard lock { mutex };
+                stopping = true;
+            }
+            requested.notify_all();
+            for (std::thread& loader : loaders) loader.join();
+
+            for (const Slot& slot : slots) {
+                if (slot.texture.is_valid()) renderer.destroy_texture(slot.texture);
+            }
+            for (const Texture texture : released_textures) renderer.destroy_texture(texture);
+        }
+
+        void run_loader(const std::size_t loader_index) {
+            Profiler::set_thread_name("Asset Loader " + std::to_string(loader_index));
+
+            while (true) {
+                Request request;
+                {
+                    std::unique_lock lock { mutex };
+                    requested.wait(lock, [&] { return stopping || !requests.empty(); });
+                    if (stopping) return;
+
+                    request = std::move(requests.front());
+                    requests.pop_front();
+                }
+
+                Decoded result { request.asset, request.serial, false, {} };
+                {
+                    VN_PROFILE_ZONE("DecodeAsset");
+                    // Archived files are decoded straight from the map, without reading them first.
+                    const std::span<const std::byte> packed = request.from_archive
+                        ? archive.find(request.path)
+                        : std::span<const std::byte> {};
+                    result.loaded = !packed.empty()
+                        ? load_image(packed, result.image)
+                        : load_image(request.path, result.image);
+                }
+
+                std::lock_guard lock { mutex };
+                decoded.push_back(std::move(result));
+            }
+        }
+
+        /**
+         * Returns the index of the slot requested as `path`, or `TextureAsset::InvalidIndex`.
+         */
+        [[nodiscard]] std::uint32_t find_slot(const std::string_view path) const {
+            const auto [first, last] = path_lookup.equal_range(fnv1a_64(path));
+            for (auto it = first; it != last; ++it) {
+                if (slots[it->second].path == path) return it->second;
+            }
+            return TextureAsset::InvalidIndex;
+        }
+
+        [[nodiscard]] Slot* get_slot(const TextureAsset asset) {
+            if (!asset.is_valid() || asset.index >= slots.size()) return nullptr;
+
+            Slot& slot = slots[asset.index];
+            return slot.generation == asset.generation && slot.references > 0 ? &slot : nullptr;
+        }
+
+        [[nodiscard]] const Slot* get_slot(const TextureAsset asset) const {
+            return const_cast<Impl*>(this)->get_slot(asset);
+        }
+
+        void unload(const TextureAsset asset) {
+            Slot& slot = slots[asset.index];
+
+            if (slot.state == AssetState::Loading) {
+                --pending_count;
+
+                // Drop the request if no loader has picked it up yet, the result of one in progress is discarded.
+                std::lock_guard lock { mutex };
+                std::erase_if(requests, [&](const Request& request) { return request.asset == asset; });
+            }
+            if (slot.texture.is_valid()) {
+                // Frames recorded since may still draw it, so it is destroyed at the start of the next one.
+                released_textures.push_back(slot.texture);
+            }
+
+            const auto [first, last] = path_lookup.equal_range(fnv1a_64(slot.path));
+            path_lookup.erase(std::find_if(first, last, [&](const auto& entry) { return entry.second == asset.index; }));
+            slot = { .generation = slot.generation + 1 };
+            free_slots.push_back(asset.index);
+        }
+    };
+
+    AssetManager::AssetManager(Renderer& renderer, const AssetArchive& archive, const AssetSettings& asset_settings)
+        : m_impl(std::make_unique<Impl>(renderer, archive, asset_settings)) {}
+
+    AssetManager::~AssetManager() = default;
+
+    TextureAsset AssetManager::load_texture(const std::string_view path) {
+        if (const std::uint32_t index = m_impl->find_slot(path); index != TextureAsset::InvalidIndex) {
+            Impl::Slot& slot = m_impl->slots[index];
+            ++slot.references;
+            return { index, slot.generation };
+        }
+
+        std::uint32_t index;
+        if (!m_impl->free_slots.empty()) {
+            index = m_impl->free_slots.back();
+            m_impl->free_slots.pop_back();
+        } else {
+            index = static_cast<std::uint32_t>(m_impl->slots.size());
+            m_impl->slots.emplace_back();
+        }
+
+        Impl::Slot& slot = m_impl->slots[index];
+        slot.path = path;
+        slot.references = 1;
+        slot.state = AssetState::Loading;
+        m_impl->path_lookup.emplace(fnv1a_64(path), index);
+        ++m_impl->pending_count;
+
+        const TextureAsset asset { index, slot.generation };
+        {
+            std::lock_guard lock { m_impl->mutex };
+            m_impl->requests.push_back({ asset, ++slot.serial, slot.path, true });
+        }
+        m_impl->requested.notify_one();
+        return asset;
+    }
+
+    bool AssetManager::reload(const std::string_view path, const std::string_view source_path) {
+        const std::uint32_t index = m_impl->find_slot(path);
+        if (index == TextureAsset::InvalidIndex) return false;
+
+        Impl::Slot& slot = m_impl->slots[index];
+        const TextureAsset asset { index, slot.generation };
+        {
+            std::lock_guard lock { m_impl->mutex };
+            m_impl->requests.push_back({ asset, ++slot.serial, std::string { source_path }, false });
+        }
+        m_impl->requested.notify_one();
+        return true;
+    }
+
+    void AssetManager::retain(const TextureAsset asset) {
+        if (Impl::Slot* slot = m_impl->get_slot(asset)) ++slot->references;
+    }
+
+    void AssetManager::release(const TextureAsset asset) {
+        Impl::Slot* slot = m_impl->get_slot(asset);
+        if (!slot) return;
+
+        if (--slot->references == 0) m_impl->unload(asset);
+    }
+
+    AssetState AssetManager::get_state(const TextureAsset asset) const {
+        const Impl::Slot* slot = m_impl->get_slot(asset);
+        return slot ? slot->state : AssetState::Unloaded;
+    }
+
+    Texture AssetManager::get_texture(const TextureAsset asset) const {
+        const Impl::Slot* slot = m_impl->get_slot(asset);
+        return slot ? slot->texture : Texture {};
+    }
+
+    std::size_t AssetManager::get_pending_count() const noexcept {
+        return m_impl->pending_count;
+    }
+
+    void AssetManager::update() {
+        for (const Texture texture : m_impl->released_textures) m_impl->renderer.destroy_texture(texture);
+        m_impl->released_textures.clear();
+
+        std::vector<Impl::Decoded> decoded;
+        {
+            std::lock_guard lock { m_impl->mutex };
+            if (m_impl->decoded.empty()) return;
+            decoded.swap(m_impl->decoded);
+        }
+
+        std::size_t uploaded = 0;
+        auto it = decoded.begin();
+        for (; it != decoded.end(); ++it) {
+            Impl::Slot* slot = m_impl->get_slot(it->asset);
+            if (!slot) continue; // Released while loading.
+
+            // With several loaders, an earlier request may finish after a later one, such as a reload queued
+            // while the texture was still loading, or two quick saves of the same file.
+            if (it->serial != slot->serial) continue;
+
+            const bool loading = slot->state == AssetState::Loading;
+            if (!it->loaded) {
+                // A failed reload keeps the previous texture.
+                Logger::error("Failed to load texture: " + slot->path);
+                if (loading) {
+                    slot->state = AssetState::Failed;
+                    --m_impl->pending_count;
+                }
+                continue;
+            }
+
+            // Always upload at least one, so that images larger than the budget still load.
+            if (uploaded > 0 && uploaded + it->image.pixels.size() > m_impl->upload_budget) break;
+            uploaded += it->image.pixels.size();
+
+            const Texture texture = m_impl->renderer.create_texture(it->image.width, it->image.height, it->image.pixels.data());
+            if (texture.is_valid()) {
+                // Swapped between frames, the previous texture is destroyed once no frame draws it anymore.
+                if (slot->texture.is_valid()) m_impl->released_textures.push_back(slot->texture);
+                slot->texture = texture;
+                slot->state = AssetState::Ready;
+            } else if (!slot->texture.is_valid()) {
+                slot->state = AssetState::Failed;
+            }
+            if (loading) --m_impl->pending_count;
+        }
+
+        if (it == decoded.end()) return;
+
+        // Over budget, the rest waits for the next frames, ahead of anything decoded since.
+        std::lock_guard lock { m_impl->mutex };
+        m_impl->decoded.insert(
+            m_impl->decoded.begin(),
+            std::make_move_iterator(it), std::make_move_iterator(decoded.end())
+        );
+    }
+} // vn
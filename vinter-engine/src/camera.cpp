@@ -0,0 +1,47 @@
+#include "vinter/camera.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "vinter/settings/window_settings.hpp"
+
+namespace vn {
+    Camera::Camera(const WindowSettings& window_settings, const int window_width, const int window_height)
+        : m_virtual_size(
+            static_cast<float>(std::max(window_settings.virtual_size.width, 1)),
+            static_cast<float>(std::max(window_settings.virtual_size.height, 1))
+        ),
+          m_integer_scaling(window_settings.integer_scaling) {
+        set_window_size(window_width, window_height);
+    }
+
+    Rect Camera::get_view_rect() const noexcept {
+        const glm::vec2 size = m_virtual_size / zoom;
+        const glm::vec2 top_left = position - size * 0.5f;
+        return { top_left.x, top_left.y, size.x, size.y };
+    }
+
+    glm::vec2 Camera::world_to_screen(const glm::vec2 world_position) const noexcept {
+        return m_viewport.get_position() + m_viewport.get_size() * 0.5f + (world_position - position) * get_pixel_scale();
+    }
+
+    glm::vec2 Camera::screen_to_world(const glm::vec2 screen_position) const noexcept {
+        return position + (screen_position - m_viewport.get_position() - m_viewport.get_size() * 0.5f) / get_pixel_scale();
+    }
+
+    void Camera::set_window_size(const int width, const int height) noexcept {
+        const glm::vec2 window_size { std::max(width, 1), std::max(height, 1) };
+
+        float scale = std::min(window_size.x / m_virtual_size.x, window_size.y / m_virtual_size.y);
+        if (m_integer_scaling && scale >= 1.f) {
+            scale = std::floor(scale);
+        }
+
+        // Whole pixels, so that the edges of the letterbox never bleed.
+        const glm::vec2 size = glm::floor(m_virtual_size * scale);
+        const glm::vec2 offset = glm::floor((window_size - size) * 0.5f);
+
+        m_viewport = { offset.x, offset.y, size.x, size.y };
+        m_viewport_scale = scale;
+    }
+} // vn
@@ -1,49 +1,188 @@
 #include "vinter/engine.hpp"
 
+#include <filesystem>
+#include <stdexcept>
+
 #include <SDL3/SDL.h> // Temporary for early debugging.
 
 namespace vn {
     Engine::Engine(const ProjectSettings& project_settings) {
-        if (!SDL_Init(
-            SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_EVENTS | SDL_INIT_GAMEPAD | SDL_INIT_JOYSTICK
-        )) {
-            throw std::runtime_error(SDL_GetError());
+        if (project_settings.logger.async) {
+            Logger::start_async(project_settings.logger.file_path);
         }
 
-        // Forgo member initialization list to initialize SDL before other systems.
-        // TODO: Bring back member initialization for Engine constructor or find better alternative.
-        window = std::make_unique<Window>(project_settings.window);
-        renderer = Renderer::create(project_settings.renderer, *window);
-        time = std::make_unique<Time>();
-        devices = std::make_unique<DeviceManager>();
-        input = std::make_unique<InputMap>(*devices);
+        // A throwing constructor never runs the destructor, which would leave SDL initialized and the async logger
+        // running, possibly without flushing the error logged before the throw.
+        try {
+            if (project_settings.window.headless) {
+                SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+                SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+            }
+
+            if (!SDL_Init(
+                SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_EVENTS | SDL_INIT_GAMEPAD | SDL_INIT_JOYSTICK
+            )) {
+                throw std::runtime_error(SDL_GetError());
+            }
+
+            // Forgo member initialization list to initialize SDL before other systems.
+            // TODO: Bring back member initialization for Engine constructor or find better alternative.
+            jobs = std::make_unique<JobSystem>(project_settings.jobs);
+            frame_arena = std::make_unique<FrameArena>(project_settings.memory.frame_arena_size);
+            archive = std::make_unique<AssetArchive>();
+            if (!project_settings.assets.archive_path.empty() && !archive->open(project_settings.assets.archive_path)) {
+                throw std::runtime_error("Failed to open asset archive: " + project_settings.assets.archive_path);
+            }
+            window = std::make_unique<Window>(project_settings.window);
+            camera = std::make_unique<Camera>(project_settings.window, window->get_width(), window->get_height());
+            RendererSettings renderer_settings = project_settings.renderer;
+            if (project_settings.window.headless) {
+                renderer_settings.backend = RendererSettings::Backend::Null;
+            }
+            renderer = Renderer::create(renderer_settings, *window);
+            text = std::make_unique<TextRenderer>(*renderer);
+            assets = std::make_unique<AssetManager>(*renderer, *archive, project_settings.assets);
+            watcher = std::make_unique<FileWatcher>();
+            for (const std::string& directory : project_settings.assets.watch_directories) {
+                watcher->watch_directory(directory);
+            }
+            time = std::make_unique<Time>(project_settings.time);
+            devices = std::make_unique<DeviceManager>();
+            input = std::make_unique<InputMap>(*devices);
+            if (!project_settings.input.bindings_path.empty()) {
+                if (!input->load_bindings(project_settings.input.bindings_path)) {
+                    throw std::runtime_error("Failed to load bindings: " + project_settings.input.bindings_path);
+                }
+                if (project_settings.input.watch_bindings && watcher->watch_file(project_settings.input.bindings_path)) {
+                    m_watched_bindings_path = std::filesystem::path { project_settings.input.bindings_path }.lexically_normal().generic_string();
+                }
+            }
+            registry = std::make_unique<entt::registry>();
+            systems = std::make_unique<SystemScheduler>(*registry, *jobs);
+            physics = std::make_unique<PhysicsWorld>(*registry, *jobs, project_settings.physics);
+
+            if (!project_settings.input.replay_path.empty()) {
+                devices->start_replay(project_settings.input.replay_path);
+            }
+            if (!project_settings.input.record_path.empty()) {
+                devices->start_recording(project_settings.input.record_path);
+            }
+            m_quit_on_replay_end = project_settings.input.quit_on_replay_end;
+        } catch (...) {
+            shutdown();
+            throw;
+        }
     }
 
-    Engine::~Engine() { SDL_Quit(); }
+    Engine::~Engine() {
+        shutdown();
+    }
+
+    void Engine::shutdown() {
+        if (renderer) renderer->stop_render_thread();
+
+        // Every thread that may still log is joined, and every SDL resource released, before both shut down.
+        assets.reset();
+        watcher.reset();
+        physics.reset();
+        systems.reset();
+        jobs.reset();
+        text.reset();
+        renderer.reset();
+        input.reset();
+        devices.reset();
+        window.reset();
+
+        SDL_Quit();
+        Logger::stop_async();
+    }
 
     void Engine::run() {
         m_running = true;
 
         load();
 
+        // Bodies are only stepped before `fixed_update`, without a fixed timestep they would silently never move.
+        if (!time->is_fixed_timestep() && !registry->view<RigidBody>().empty()) {
+            Logger::warning("Rigid bodies were created without TimeSettings::fixed_timestep, physics will not run.");
+        }
+
+        Profiler::set_thread_name("Main");
+
         while (m_running) {
-            SDL_Event sdl_event;
-            while (SDL_PollEvent(&sdl_event)) {
-                if (sdl_event.type == SDL_EVENT_QUIT) {
-                    m_running = false;
+            VN_PROFILE_ZONE("Frame");
+            frame_arena->reset();
+
+            {
+                VN_PROFILE_ZONE("Events");
+                SDL_Event sdl_event;
+                while (SDL_PollEvent(&sdl_event)) {
+                    if (sdl_event.type == SDL_EVENT_QUIT) {
+                        m_running = false;
+                    }
+                    window->handle_events(sdl_event);
+                    if (sdl_event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED) {
+                        camera->set_window_size(window->get_width(), window->get_height());
+                    }
+                    devices->handle_events(sdl_event);
+                }
+                poll_events();
+            }
+
+            {
+                VN_PROFILE_ZONE("Assets");
+                watcher->poll(m_file_changes);
+                for (const FileChange& change : m_file_changes) {
+                    if (change.path == m_watched_bindings_path) {
+                        // Actions keep their handles, a failed reload keeps the current bindings.
+                        input->load_bindings(change.path);
+                        continue;
+                    }
+
+                    // Loaded from disk by their full path, or from the archive by the path within the directory.
+                    if (!assets->reload(change.path, change.path)) assets->reload(change.relative_path, change.path);
                 }
-                window->handle_events(sdl_event);
-                devices->handle_events(sdl_event);
+                assets->update();
             }
-            poll_events();
 
-            time->update();
-            update(time->get_delta());
-            devices->update();
+            {
+                VN_PROFILE_ZONE("Devices");
+                float delta = time->measure_delta();
+                devices->update(delta);
+                time->advance(delta);
+                input->update();
 
-            renderer->begin_frame();
-            render();
-            renderer->end_frame();
+                if (devices->has_replay_ended() && m_quit_on_replay_end) {
+                    m_running = false;
+                }
+            }
+            {
+                VN_PROFILE_ZONE("FixedUpdate");
+                while (time->consume_fixed_step()) {
+                    physics->step(time->get_fixed_delta());
+                    fixed_update(time->get_fixed_delta());
+                }
+            }
+            {
+                VN_PROFILE_ZONE("Update");
+                update(time->get_delta());
+            }
+            {
+                VN_PROFILE_ZONE("Systems");
+                systems->run(time->get_delta());
+            }
+            {
+                VN_PROFILE_ZONE("Render");
+                renderer->set_camera(*camera);
+                renderer->begin_recording();
+                text->begin_frame();
+                render();
+            }
+            {
+                VN_PROFILE_ZONE("Present");
+                text->end_frame();
+                renderer->submit_recording();
+            }
         }
     }
 
@@ -0,0 +1,336 @@
+#include "vinter/file_watcher.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#ifdef __linux__
+    #include <cerrno>
+    #include <cstring>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#else
+    #include <chrono>
+    #include <condition_variable>
+#endif
+
+#include "vinter/logger.hpp"
+#include "vinter/profiler.hpp"
+
+namespace vn {
+    namespace fs = std::filesystem;
+
+    namespace {
+        /**
+         * Changes reported by the watching thread and not polled yet, each path once.
+         */
+        struct PendingChanges {
+            std::mutex mutex;
+            std::vector<FileChange> changes;
+            std::unordered_set<std::string> paths;
+
+            void add(const fs::path& path, const fs::path& root) {
+                std::string path_string = path.lexically_normal().generic_string();
+
+                std::lock_guard lock { mutex };
+                if (!paths.insert(path_string).second) return;
+                changes.push_back({ std::move(path_string), path.lexically_relative(root).generic_string() });
+            }
+
+            void take(std::vector<FileChange>& out) {
+                out.clear();
+
+                std::lock_guard lock { mutex };
+                out.swap(changes);
+                paths.clear();
+            }
+        };
+    }
+
+#ifdef __linux__
+    struct FileWatcher::Impl {
+        struct Watch {
+            fs::path directory;
+            fs::path root;                      // Reported paths are relative to it.
+            bool recursive { false };
+            bool all_files { false };
+            std::vector<std::string> files;     // Watched names in the directory, unless `all_files`.
+        };
+
+        int inotify_fd { -1 };
+        int stop_pipe[2] { -1, -1 };
+        std::thread thread;
+
+        std::mutex mutex;
+        std::unordered_map<int, Watch> watches; // Keyed by watch descriptor.
+
+        PendingChanges pending;
+
+        Impl() {
+            inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if (inotify_fd < 0) {
+                Logger::error("Failed to initialize inotify: " + std::string { std::strerror(errno) });
+                return;
+            }
+            if (pipe2(stop_pipe, O_CLOEXEC) != 0) {
+                Logger::error("Failed to create the file watcher's stop pipe: " + std::string { std::strerror(errno) });
+                return;
+            }
+            thread = std::thread([this] { run(); });
+        }
+
+        ~Impl() {
+            if (thread.joinable()) {
+                const char stop = 0;
+                [[maybe_unused]] const ssize_t written = write(stop_pipe[1], &stop, 1);
+                thread.join();
+            }
+            for (const int fd : { inotify_fd, stop_pipe[0], stop_pipe[1] }) {
+                if (fd >= 0) ::close(fd);
+            }
+        }
+
+        bool add_watch(const fs::path& directory, const fs::path& root, const bool recursive, const std::string_view file) {
+            if (!thread.joinable()) return false;
+
+            const int wd = inotify_add_watch(
+                inotify_fd, directory.c_str(),
+                IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ONLYDIR
+            );
+            if (wd < 0) {
+                Logger::error("Failed to watch " + directory.string() + ": " + std::strerror(errno));
+                return false;
+            }
+
+            {
+                // Watching a directory again returns its existing descriptor, the watches are merged.
+                std::lock_guard lock { mutex };
+                Watch& watch = watches[wd];
+                if (watch.directory.empty()) {
+                    watch.directory = directory;
+                    watch.root = root;
+                }
+                watch.recursive = watch.recursive || recursive;
+                watch.all_files = watch.all_files || file.empty();
+                if (!file.empty()) watch.files.emplace_back(file);
+            }
+
+            if (recursive) {
+                std::error_code error;
+                for (const fs::directory_entry& entry : fs::directory_iterator { directory, error }) {
+                    if (entry.is_directory(error)) add_watch(entry.path(), root, true, {});
+                }
+            }
+            return true;
+        }
+
+        void run() {
+            Profiler::set_thread_name("File Watcher");
+
+            // Large enough for many events at once, aligned for reading them in place.
+            alignas(inotify_event) char buffer[16 * 1024];
+            pollfd fds[2] { { inotify_fd, POLLIN, 0 }, { stop_pipe[0], POLLIN, 0 } };
+
+            while (true) {
+                if (::poll(fds, 2, -1) < 0) {
+                    if (errno == EINTR) continue;
+                    Logger::error("File watcher stopped: " + std::string { std::strerror(errno) });
+                    return;
+                }
+                if (fds[1].revents != 0) return;
+
+                ssize_t length;
+                while ((length = read(inotify_fd, buffer, sizeof(buffer))) > 0) {
+                    for (ssize_t offset = 0; offset < length;) {
+                        const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                        handle_event(*event);
+                        offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+                    }
+                }
+            }
+        }
+
+        void handle_event(const inotify_event& event) {
+            if (event.mask & IN_Q_OVERFLOW) {
+                Logger::warning("File watcher events overflowed, some changes were missed.");
+                return;
+            }
+
+            fs::path path;
+            fs::path root;
+            bool watch_subdirectory = false;
+            {
+                std::lock_guard lock { mutex };
+                const auto it = watches.find(event.wd);
+                if (it == watches.end()) return;
+
+                if (event.mask & IN_IGNORED) {
+                    watches.erase(it);
+                    return;
+                }
+                if (event.len == 0) return;
+
+                const Watch& watch = it->second;
+                const std::string_view name { event.name };
+                if (event.mask & IN_ISDIR) {
+                    watch_subdirectory = watch.recursive && (event.mask & (IN_CREATE | IN_MOVED_TO));
+                } else if (!(event.mask & (IN_CLOSE_WRITE | IN_MOVED_TO))) {
+                    return; // Created files are reported once written and closed.
+                } else if (!watch.all_files && std::ranges::find(watch.files, name) == watch.files.end()) {
+                    return;
+                }
+
+                path = watch.directory / name;
+                root = watch.root;
+            }
+
+            if (watch_subdirectory) {
+                add_watch(path, root, true, {});
+            } else {
+                pending.add(path, root);
+            }
+        }
+
+        bool watch_directory(const fs::path& directory) {
+            return add_watch(directory, directory, true, {});
+        }
+
+        bool watch_file(const fs::path& file) {
+            // Watching the directory rather than the file survives editors replacing the file on save.
+            const fs::path directory = file.has_parent_path() ? file.parent_path() : fs::path { "." };
+            return add_watch(directory, directory, false, file.filename().string());
+        }
+    };
+#else
+    struct FileWatcher::Impl {
+        static constexpr std::chrono::milliseconds Interval { 500 };
+
+        struct Root {
+            fs::path path;
+            bool is_directory;
+        };
+
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable stopped;
+        bool stopping { false };
+
+        std::vector<Root> roots;
+        std::unordered_map<std::string, fs::file_time_type> write_times; // Keyed by path.
+
+        PendingChanges pending;
+
+        ~Impl() {
+            if (!thread.joinable()) return;
+            {
+                std::lock_guard lock { mutex };
+                stopping = true;
+            }
+            stopped.notify_all();
+            thread.join();
+        }
+
+        /**
+         * Records the write time of a file, returning whether it changed since it was last recorded.
+         */
+        bool update_write_time(const fs::path& file) {
+            std::error_code error;
+            const fs::file_time_type write_time = fs::last_write_time(file, error);
+            if (error) return false;
+
+            const auto [it, inserted] = write_times.try_emplace(file.generic_string(), write_time);
+            if (inserted) return true;
+            if (it->second == write_time) return false;
+
+            it->second = write_time;
+            return true;
+        }
+
+        /**
+         * Calls `visit(file)` for every existing file of a root.
+         */
+        template<typename F>
+        static void for_each_file(const Root& root, F&& visit) {
+            std::error_code error;
+            if (!root.is_directory) {
+                if (fs::is_regular_file(root.path, error)) visit(root.path);
+                return;
+            }
+
+            for (auto it = fs::recursive_directory_iterator { root.path, error };
+                 !error && it != fs::recursive_directory_iterator {}; it.increment(error)) {
+                if (it->is_regular_file(error)) visit(it->path());
+            }
+        }
+
+        void scan() {
+            std::lock_guard lock { mutex };
+            for (const Root& root : roots) {
+                const fs::path base = root.is_directory ? root.path : root.path.parent_path();
+                for_each_file(root, [&](const fs::path& file) {
+                    if (update_write_time(file)) pending.add(file, base);
+                });
+            }
+        }
+
+        void run() {
+            Profiler::set_thread_name("File Watcher");
+
+            std::unique_lock lock { mutex };
+            while (!stopped.wait_for(lock, Interval, [&] { return stopping; })) {
+                lock.unlock();
+                scan();
+                lock.lock();
+            }
+        }
+
+        bool add_root(Root root) {
+            std::error_code error;
+            if (root.is_directory && !fs::is_directory(root.path, error)) {
+                Logger::error("Failed to watch " + root.path.string() + ": not a directory");
+                return false;
+            }
+
+            {
+                // Files already there are known, only later changes are reported.
+                std::lock_guard lock { mutex };
+                for_each_file(root, [&](const fs::path& file) { update_write_time(file); });
+                roots.push_back(std::move(root));
+            }
+
+            if (!thread.joinable()) thread = std::thread([this] { run(); });
+            return true;
+        }
+
+        bool watch_directory(const fs::path& directory) {
+            return add_root({ directory, true });
+        }
+
+        bool watch_file(const fs::path& file) {
+            return add_root({ file, false });
+        }
+    };
+#endif
+
+    FileWatcher::FileWatcher() : m_impl(std::make_unique<Impl>()) {}
+
+    FileWatcher::~FileWatcher() = default;
+
+    bool FileWatcher::watch_directory(const std::string_view path) {
+        return m_impl->watch_directory(fs::path { path });
+    }
+
+    bool FileWatcher::watch_file(const std::string_view path) {
+        return m_impl->watch_file(fs::path { path });
+    }
+
+    void FileWatcher::poll(std::vector<FileChange>& changes) {
+        m_impl->pending.take(changes);
+    }
+} // vn
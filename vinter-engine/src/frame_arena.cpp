@@ -0,0 +1,47 @@
+#include "vinter/frame_arena.hpp"
+
+#include <algorithm>
+
+namespace vn {
+    FrameArena::FrameArena(const std::size_t capacity) {
+        Block& block = m_blocks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(capacity), capacity);
+        use_block(block);
+    }
+
+    void FrameArena::reset() {
+        if (m_blocks.size() > 1) {
+            std::size_t capacity = 0;
+            for (const Block& block : m_blocks) capacity += block.size;
+
+            m_blocks.clear();
+            m_blocks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(capacity), capacity);
+        }
+        m_used_before_current = 0;
+        use_block(m_blocks.back());
+    }
+
+    std::size_t FrameArena::get_used_size() const noexcept {
+        return m_used_before_current + (m_cursor - reinterpret_cast<std::uintptr_t>(m_blocks.back().data.get()));
+    }
+
+    std::size_t FrameArena::get_capacity() const noexcept {
+        std::size_t capacity = 0;
+        for (const Block& block : m_blocks) capacity += block.size;
+        return capacity;
+    }
+
+    void* FrameArena::allocate_block(const std::size_t size, const std::size_t alignment) {
+        // Grow geometrically, so that a frame far larger than the arena only adds a few blocks.
+        const std::size_t block_size = std::max(m_blocks.back().size * 2, size + alignment);
+
+        m_used_before_current = get_used_size();
+        Block& block = m_blocks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(block_size), block_size);
+        use_block(block);
+        return allocate(size, alignment);
+    }
+
+    void FrameArena::use_block(Block& block) noexcept {
+        m_cursor = reinterpret_cast<std::uintptr_t>(block.data.get());
+        m_end = m_cursor + block.size;
+    }
+} // vn
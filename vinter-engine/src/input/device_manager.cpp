@@ -2,12 +2,15 @@
 
 #include <ranges>
 #include <cassert>
+#include <string>
 
 #include <SDL3/SDL.h>
 
 #include "vinter/input/keyboard.hpp"
 #include "vinter/input/mouse.hpp"
 #include "vinter/input/gamepad.hpp"
+#include "vinter/logger.hpp"
+#include "input_recording.hpp"
 
 namespace vn {
     DeviceManager::DeviceManager() {
@@ -23,6 +26,8 @@ namespace vn {
         SDL_free(joystick_ids);
     }
 
+    DeviceManager::~DeviceManager() = default;
+
     Keyboard& DeviceManager::get_keyboard() const noexcept {
         return *m_keyboard;
     }
@@ -35,6 +40,13 @@ namespace vn {
         // NOTE: We could cache this but the construction cost is minimal.
         std::array<Gamepad*, MaxGamepadCount> result {};
 
+        if (m_replay) {
+            for (std::size_t i = 0; i < MaxGamepadCount; i++) {
+                result[i] = m_replay_gamepads[i].get();
+            }
+            return result;
+        }
+
         for (std::size_t i = 0; i < MaxGamepadCount; i++)
             if (const auto& optional_id = m_gamepad_slots[i]; optional_id) {
                 if (auto it = m_gamepads.find(*optional_id); it != m_gamepads.end()) {
@@ -44,8 +56,8 @@ namespace vn {
         return result;
     }
 
-    std::vector<Gamepad*> DeviceManager::get_active_gamepads() const noexcept {
-        std::vector<Gamepad*> result;
+    std::pmr::vector<Gamepad*> DeviceManager::get_active_gamepads(std::pmr::memory_resource* resource) const {
+        std::pmr::vector<Gamepad*> result { resource };
         result.reserve(MaxGamepadCount);
 
         for (const auto& gamepad : get_gamepads()) {
@@ -64,6 +76,8 @@ namespace vn {
     Gamepad* DeviceManager::get_gamepad(const std::size_t slot) const noexcept {
         assert(slot < MaxGamepadCount && "Gamepad slot out of range.");
 
+        if (m_replay) return m_replay_gamepads[slot].get();
+
         if (const auto& optional_id = m_gamepad_slots[slot]; optional_id) {
             return get_gamepad_by_id(*optional_id);
         }
@@ -71,26 +85,137 @@ namespace vn {
     }
 
     void DeviceManager::handle_events(const SDL_Event& event) {
-        m_keyboard->handle_events(event);
-        m_mouse->handle_events(event);
+        // Recorded input takes the place of device input during a replay.
+        if (!m_replay) {
+            m_keyboard->handle_events(event);
+            m_mouse->handle_events(event);
+        }
+
+        switch (event.type) {
+            case SDL_EVENT_GAMEPAD_ADDED:
+                handle_gamepad_added(event.gdevice.which);
+                break;
+            case SDL_EVENT_GAMEPAD_REMOVED:
+                handle_gamepad_removed(event.gdevice.which);
+                break;
+
+            // Route gamepad input only to the gamepad that produced it.
+            case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+            case SDL_EVENT_GAMEPAD_BUTTON_UP:
+                if (m_replay) break;
+                if (auto* gamepad = get_gamepad_by_id(event.gbutton.which)) gamepad->handle_events(event);
+                break;
+            case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+                if (m_replay) break;
+                if (auto* gamepad = get_gamepad_by_id(event.gaxis.which)) gamepad->handle_events(event);
+                break;
 
-        if (event.type == SDL_EVENT_GAMEPAD_ADDED) {
-            handle_gamepad_added(event.gdevice.which);
+            default:
+                break;
         }
-        if (event.type == SDL_EVENT_GAMEPAD_REMOVED) {
-            handle_gamepad_removed(event.gdevice.which);
+    }
+
+    void DeviceManager::update(float& delta) {
+        m_replay_ended = false;
+
+        if (m_replay) {
+            float recorded_delta = 0.f;
+            DeviceSnapshot snapshot;
+            if (m_replay->read_frame(recorded_delta, snapshot)) {
+                delta = recorded_delta;
+                load_snapshot(snapshot);
+            } else {
+                stop_replay();
+                m_replay_ended = true;
+                Logger::info("Input replay ended.");
+            }
         }
 
-        for (const auto& gamepad : m_gamepads | std::views::values) {
-            gamepad->handle_events(event);
+        if (!m_replay) {
+            m_keyboard->update();
+            m_mouse->update();
+            for (const auto& gamepad : m_gamepads | std::views::values) {
+                gamepad->update();
+            }
+        }
+
+        if (m_recording) {
+            DeviceSnapshot snapshot;
+            save_snapshot(snapshot);
+            m_recording->write_frame(delta, snapshot);
+        }
+    }
+
+    bool DeviceManager::start_recording(const std::string_view path) {
+        auto recording = std::make_unique<InputRecordWriter>(path);
+        if (!recording->is_open()) {
+            Logger::error("Failed to open input recording for writing: " + std::string { path });
+            return false;
         }
+        m_recording = std::move(recording);
+        return true;
     }
 
-    void DeviceManager::update() {
-        m_keyboard->update();
-        m_mouse->update();
-        for (const auto& gamepad : m_gamepads | std::views::values) {
-            gamepad->update();
+    void DeviceManager::stop_recording() {
+        m_recording.reset();
+    }
+
+    bool DeviceManager::is_recording() const noexcept {
+        return m_recording != nullptr;
+    }
+
+    bool DeviceManager::start_replay(const std::string_view path) {
+        auto replay = std::make_unique<InputRecordReader>(path);
+        if (!replay->is_open()) {
+            Logger::error("Failed to open input recording for replay: " + std::string { path });
+            return false;
+        }
+        m_replay = std::move(replay);
+        m_replay_ended = false;
+        return true;
+    }
+
+    void DeviceManager::stop_replay() {
+        if (!m_replay) return;
+
+        // Release everything the replay held down, so no input sticks once the devices take over again.
+        load_snapshot(DeviceSnapshot {});
+        m_replay.reset();
+        for (auto& gamepad : m_replay_gamepads) {
+            gamepad.reset();
+        }
+    }
+
+    bool DeviceManager::is_replaying() const noexcept {
+        return m_replay != nullptr;
+    }
+
+    bool DeviceManager::has_replay_ended() const noexcept {
+        return m_replay_ended;
+    }
+
+    void DeviceManager::save_snapshot(DeviceSnapshot& snapshot) const {
+        m_keyboard->save_snapshot(snapshot.keyboard);
+        m_mouse->save_snapshot(snapshot.mouse);
+
+        const auto gamepads = get_gamepads();
+        for (std::size_t i = 0; i < MaxGamepadCount; i++) {
+            if (gamepads[i]) gamepads[i]->save_snapshot(snapshot.gamepads[i]);
+        }
+    }
+
+    void DeviceManager::load_snapshot(const DeviceSnapshot& snapshot) {
+        m_keyboard->load_snapshot(snapshot.keyboard);
+        m_mouse->load_snapshot(snapshot.mouse);
+
+        for (std::size_t i = 0; i < MaxGamepadCount; i++) {
+            auto& gamepad = m_replay_gamepads[i];
+            if (!snapshot.gamepads[i].connected) {
+                gamepad.reset();
+                continue;
+            }
+            if (!gamepad) gamepad.reset(new Gamepad());
+            gamepad->load_snapshot(snapshot.gamepads[i]);
         }
     }
 
@@ -9,6 +9,7 @@
 
 #include "vinter/color.hpp"
 #include "vinter/input/button_states.hpp"
+#include "input_recording.hpp"
 
 namespace vn {
     static float normalize_axis(const float axis) noexcept {
@@ -45,12 +46,26 @@ namespace vn {
     struct Gamepad::Impl {
         SDL_Gamepad* sdl_gamepad { nullptr };
         ButtonStates<SDL_GAMEPAD_BUTTON_COUNT> button_states {};
-        std::array<float, SDL_GAMEPAD_AXIS_COUNT> sdl_axis_states_current {}, sdl_axis_states_previous {};
+        std::array<std::uint64_t, SDL_GAMEPAD_BUTTON_COUNT> button_timestamps {};
+        std::array<float, SDL_GAMEPAD_AXIS_COUNT> sdl_axis_states_pending {}, sdl_axis_states_current {};
         std::array<float, static_cast<std::size_t>(Axis::Count)> axis_states_current {}, axis_states_previous {};
+        bool axes_dirty { true };
+
+        Impl() = default;
 
         explicit Impl(const unsigned int joystick_id) {
             sdl_gamepad = SDL_OpenGamepad(joystick_id);
             assert(sdl_gamepad && "Failed to open SDL gamepad.");
+
+            // Seed buttons and axes already held on connection, after which the state is driven by gamepad events.
+            for (std::size_t i = 0; i < SDL_GAMEPAD_BUTTON_COUNT; i++) {
+                if (SDL_GetGamepadButton(sdl_gamepad, static_cast<SDL_GamepadButton>(i))) {
+                    button_states.press(i);
+                }
+            }
+            for (std::size_t i = 0; i < SDL_GAMEPAD_AXIS_COUNT; i++) {
+                sdl_axis_states_pending[i] = normalize_axis(SDL_GetGamepadAxis(sdl_gamepad, static_cast<SDL_GamepadAxis>(i)));
+            }
         }
 
         ~Impl() {
@@ -122,6 +137,10 @@ namespace vn {
         : m_impl(std::make_unique<Impl>(joystick_id)) {
     }
 
+    Gamepad::Gamepad()
+        : m_impl(std::make_unique<Impl>()) {
+    }
+
     Gamepad::~Gamepad() = default;
 
     unsigned int Gamepad::get_id() const noexcept {
@@ -200,6 +219,12 @@ namespace vn {
         return m_impl->axis_states_current[axis_to_index(axis)];
     }
 
+    std::uint64_t Gamepad::get_button_timestamp(const Button button) const noexcept {
+        const SDL_GamepadButton sdl_button = Impl::to_sdl_gamepad_button(button);
+        if (sdl_button == SDL_GAMEPAD_BUTTON_INVALID) return 0;
+        return m_impl->button_timestamps[sdl_button];
+    }
+
     void Gamepad::begin_vibrate(
         const float weak_percent_magnitude,
         const float strong_percent_magnitude,
@@ -227,28 +252,38 @@ namespace vn {
     }
 
     void Gamepad::handle_events(const SDL_Event& event) {
+        switch (event.type) {
+            case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+            case SDL_EVENT_GAMEPAD_BUTTON_UP:
+                if (event.gbutton.button >= SDL_GAMEPAD_BUTTON_COUNT) return;
+                if (event.gbutton.down) {
+                    m_impl->button_states.press(event.gbutton.button);
+                } else {
+                    m_impl->button_states.release(event.gbutton.button);
+                }
+                m_impl->button_timestamps[event.gbutton.button] = event.gbutton.timestamp;
+                break;
+
+            case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+                if (event.gaxis.axis >= SDL_GAMEPAD_AXIS_COUNT) return;
+                m_impl->sdl_axis_states_pending[event.gaxis.axis] = normalize_axis(event.gaxis.value);
+                m_impl->axes_dirty = true;
+                break;
+
+            default:
+                break;
+        }
     }
 
     void Gamepad::update() {
-        m_impl->button_states.refresh();
-        m_impl->sdl_axis_states_previous = m_impl->sdl_axis_states_current;
+        m_impl->button_states.latch();
         m_impl->axis_states_previous = m_impl->axis_states_current;
 
-        // Synchronize buttons with sdl buttons.
-        for (std::size_t i = 0; i < SDL_GAMEPAD_BUTTON_COUNT; i++) {
-            m_impl->button_states.current[i] = SDL_GetGamepadButton(
-                m_impl->sdl_gamepad,
-                static_cast<SDL_GamepadButton>(i)
-            );
-        }
+        // Axes only need to be deadzoned and remapped again when an axis moved since the last update.
+        if (!m_impl->axes_dirty) return;
+        m_impl->axes_dirty = false;
 
-        // Normalize and store sdl axes.
-        for (std::size_t i = 0; i < SDL_GAMEPAD_AXIS_COUNT; i++) {
-            m_impl->sdl_axis_states_current[i] = normalize_axis(SDL_GetGamepadAxis(
-                m_impl->sdl_gamepad,
-                static_cast<SDL_GamepadAxis>(i)
-            ));
-        }
+        m_impl->sdl_axis_states_current = m_impl->sdl_axis_states_pending;
 
         // Deadzone sdl axes.
         apply_stick_deadzone(
@@ -267,4 +302,16 @@ namespace vn {
         // Remap sdl axes to axes.
         Impl::remap_sdl_axes(m_impl->axis_states_current, m_impl->sdl_axis_states_current);
     }
+
+    void Gamepad::save_snapshot(GamepadSnapshot& snapshot) const {
+        snapshot.connected = 1;
+        snapshot.buttons.save(m_impl->button_states);
+        snapshot.axes = m_impl->axis_states_current;
+    }
+
+    void Gamepad::load_snapshot(const GamepadSnapshot& snapshot) {
+        snapshot.buttons.load(m_impl->button_states);
+        m_impl->axis_states_previous = m_impl->axis_states_current;
+        m_impl->axis_states_current = snapshot.axes;
+    }
 } // vn
\ No newline at end of file
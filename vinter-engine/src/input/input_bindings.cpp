@@ -0,0 +1,373 @@
+#include "vinter/input/input_map.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+
+#include "vinter/logger.hpp"
+
+namespace vn {
+    namespace {
+        // Names of the enumerators, in declaration order, as written to text bindings files.
+        constexpr std::array<std::string_view, static_cast<std::size_t>(Keyboard::Key::Pause) + 1> KeyNames {
+            "F1", "F2", "F3", "F4", "F5", "F6", "F7", "F8", "F9", "F10", "F11", "F12",
+            "1", "2", "3", "4", "5", "6", "7", "8", "9", "0",
+            "Q", "W", "E", "R", "T", "Y", "U", "I", "O", "P",
+            "A", "S", "D", "F", "G", "H", "J", "K", "L",
+            "Z", "X", "C", "V", "B", "N", "M",
+            "Esc", "Tab", "CapsLock",
+            "Space", "Enter", "Backspace",
+            "Insert", "Delete", "Home", "End", "PageUp", "PageDown",
+            "Up", "Down", "Left", "Right",
+            "Minus", "Equals",
+            "LeftBracket", "RightBracket",
+            "Semicolon", "Apostrophe",
+            "Grave", "Backslash",
+            "Comma", "Period", "Slash",
+            "Numpad0", "Numpad1", "Numpad2", "Numpad3", "Numpad4",
+            "Numpad5", "Numpad6", "Numpad7", "Numpad8", "Numpad9",
+            "NumpadMultiply", "NumpadDivide", "NumpadPlus", "NumpadMinus",
+            "NumpadEnter", "NumpadPeriod",
+            "NumLock",
+            "PrintScreen", "ScrollLock", "Pause",
+        };
+        constexpr std::array<std::string_view, static_cast<std::size_t>(Mouse::Button::X2) + 1> MouseButtonNames {
+            "Left", "Right", "Middle", "X1", "X2",
+        };
+        constexpr std::array<std::string_view, static_cast<std::size_t>(Mouse::Wheel::Right) + 1> MouseWheelNames {
+            "Up", "Down", "Left", "Right",
+        };
+        constexpr std::array<std::string_view, static_cast<std::size_t>(Gamepad::Button::Misc6) + 1> GamepadButtonNames {
+            "South", "East", "West", "North",
+            "Back", "Guide", "Start",
+            "LeftStick", "RightStick", "LeftShoulder", "RightShoulder",
+            "DpadUp", "DpadDown", "DpadLeft", "DpadRight",
+            "RightPaddle1", "LeftPaddle1", "RightPaddle2", "LeftPaddle2",
+            "Touchpad",
+            "Misc1", "Misc2", "Misc3", "Misc4", "Misc5", "Misc6",
+        };
+        constexpr std::array<std::string_view, static_cast<std::size_t>(Gamepad::Axis::Count)> GamepadAxisNames {
+            "LeftStickLeft", "LeftStickRight", "LeftStickUp", "LeftStickDown",
+            "RightStickLeft", "RightStickRight", "RightStickUp", "RightStickDown",
+            "LeftTrigger", "RightTrigger",
+        };
+
+        /**
+         * How each input method is written, indexed by binding kind.
+         */
+        struct MethodFormat {
+            std::string_view name;
+            std::span<const std::string_view> inputs;
+            bool has_slot;
+        };
+
+        constexpr std::array<MethodFormat, 5> MethodFormats {{
+            { "key",            KeyNames,           false },
+            { "mouse_button",   MouseButtonNames,   false },
+            { "mouse_wheel",    MouseWheelNames,    false },
+            { "gamepad_button", GamepadButtonNames, true },
+            { "gamepad_axis",   GamepadAxisNames,   true },
+        }};
+
+        // Compiled bindings files are read in place, so their integers are stored in the host's order.
+        static_assert(std::endian::native == std::endian::little, "Compiled bindings files are little-endian.");
+
+        constexpr std::array<char, 4> CompiledMagic { 'V', 'B', 'N', 'D' };
+        constexpr std::uint32_t CompiledVersion { 1 };
+
+        /**
+         * Followed by the actions, the bindings and the action names.
+         */
+        struct CompiledHeader {
+            std::array<char, 4> magic;
+            std::uint32_t version;
+            std::uint32_t action_count;
+            std::uint32_t binding_count;
+            std::uint32_t names_size;
+            std::uint32_t reserved;
+        };
+        static_assert(sizeof(CompiledHeader) == 24);
+
+        [[nodiscard]] bool is_space(const char c) noexcept {
+            return c == ' ' || c == '\t' || c == '\r';
+        }
+
+        /**
+         * Splits a line into whitespace separated tokens, up to `#`.
+         */
+        std::size_t tokenize(std::string_view line, std::array<std::string_view, 5>& tokens) {
+            line = line.substr(0, line.find('#'));
+
+            std::size_t count = 0;
+            std::size_t i = 0;
+            while (i < line.size()) {
+                while (i < line.size() && is_space(line[i])) ++i;
+                const std::size_t begin = i;
+                while (i < line.size() && !is_space(line[i])) ++i;
+                if (i == begin) break;
+
+                if (count < tokens.size()) tokens[count] = line.substr(begin, i - begin);
+                ++count;
+            }
+            return count;
+        }
+
+        /**
+         * Writes a file next to `path` and moves it over `path`, so readers never see it half written.
+         */
+        bool write_file_atomically(const std::string_view path, const void* data, const std::size_t size) {
+            const std::filesystem::path target { path };
+            std::filesystem::path temporary = target;
+            temporary += ".tmp";
+
+            {
+                std::ofstream file { temporary, std::ios::binary | std::ios::trunc };
+                file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+                if (!file) {
+                    Logger::error("Failed to write bindings file: " + temporary.string());
+                    return false;
+                }
+            }
+
+            std::error_code error;
+            std::filesystem::rename(temporary, target, error);
+            if (error) {
+                Logger::error("Failed to replace bindings file " + target.string() + ": " + error.message());
+                std::filesystem::remove(temporary, error);
+                return false;
+            }
+            return true;
+        }
+    }
+
+    bool InputMap::parse_bindings(const std::string_view text, const std::string_view path, BindingTable& table) {
+        // Lines of one action may be anywhere in the file, they are grouped in the order actions first appear.
+        struct ParsedBinding {
+            std::uint32_t action;
+            CompiledBinding binding;
+        };
+        std::vector<ParsedBinding> parsed;
+        std::unordered_map<ActionID, std::uint32_t> lookup;
+
+        std::size_t line_number = 0;
+        for (std::size_t begin = 0; begin < text.size(); ) {
+            const std::size_t end = std::min(text.find('\n', begin), text.size());
+            const std::string_view line = text.substr(begin, end - begin);
+            begin = end + 1;
+            ++line_number;
+
+            const auto fail = [&](const std::string_view reason) {
+                Logger::error(std::string { path } + ":" + std::to_string(line_number) + ": " + std::string { reason });
+                return false;
+            };
+
+            std::array<std::string_view, 5> tokens;
+            const std::size_t token_count = tokenize(line, tokens);
+            if (token_count == 0) continue;
+            if (token_count < 3) return fail("expected <action> <method> <input> [<gamepad slot>]");
+
+            const auto method = std::ranges::find(MethodFormats, tokens[1], &MethodFormat::name);
+            if (method == MethodFormats.end()) return fail("unknown method '" + std::string { tokens[1] } + "'");
+
+            const auto input = std::ranges::find(method->inputs, tokens[2]);
+            if (input == method->inputs.end()) {
+                return fail("unknown " + std::string { method->name } + " '" + std::string { tokens[2] } + "'");
+            }
+
+            CompiledBinding binding {
+                static_cast<CompiledBinding::Kind>(method - MethodFormats.begin()),
+                CompiledBinding::AllSlots,
+                static_cast<std::uint16_t>(input - method->inputs.begin()),
+            };
+
+            if (const std::size_t max_count = method->has_slot ? 4 : 3; token_count > max_count) {
+                return fail("unexpected '" + std::string { tokens[max_count] } + "'");
+            }
+            if (token_count == 4) {
+                unsigned slot;
+                const auto [slot_end, error] = std::from_chars(tokens[3].data(), tokens[3].data() + tokens[3].size(), slot);
+                if (error != std::errc {} || slot_end != tokens[3].data() + tokens[3].size()
+                    || slot >= DeviceManager::MaxGamepadCount) {
+                    return fail("gamepad slot must be below " + std::to_string(DeviceManager::MaxGamepadCount));
+                }
+                binding.gamepad_slot = static_cast<std::int8_t>(slot);
+            }
+
+            const std::string_view name = tokens[0];
+            auto [it, inserted] = lookup.try_emplace(to_action_id(name), static_cast<std::uint32_t>(table.actions.size()));
+            if (inserted) {
+                table.actions.push_back({
+                    it->first, 0, 0,
+                    static_cast<std::uint32_t>(table.names.size()), static_cast<std::uint32_t>(name.size())
+                });
+                table.names += name;
+            }
+            ++table.actions[it->second].binding_count;
+            parsed.push_back({ it->second, binding });
+        }
+
+        // Counting sort by action, keeping the order of the lines within each action.
+        std::uint32_t offset = 0;
+        for (Action& action : table.actions) {
+            action.binding_offset = offset;
+            offset += action.binding_count;
+        }
+
+        table.bindings.resize(parsed.size());
+        std::vector<std::uint32_t> cursors(table.actions.size());
+        for (const ParsedBinding& binding : parsed) {
+            table.bindings[table.actions[binding.action].binding_offset + cursors[binding.action]++] = binding.binding;
+        }
+        return true;
+    }
+
+    bool InputMap::read_compiled_bindings(const std::span<const std::byte> data, const std::string_view path, BindingTable& table) {
+        const auto fail = [&](const std::string_view reason) {
+            Logger::error("Invalid compiled bindings file " + std::string { path } + ": " + std::string { reason });
+            return false;
+        };
+
+        CompiledHeader header;
+        if (data.size() < sizeof(header)) return fail("truncated header");
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (header.version != CompiledVersion) return fail("unsupported version " + std::to_string(header.version));
+
+        const std::size_t actions_size = std::size_t { header.action_count } * sizeof(Action);
+        const std::size_t bindings_size = std::size_t { header.binding_count } * sizeof(CompiledBinding);
+        if (data.size() != sizeof(header) + actions_size + bindings_size + header.names_size) return fail("size mismatch");
+
+        // Read straight into the table's arrays, whose layout the file shares.
+        const std::byte* cursor = data.data() + sizeof(header);
+        table.actions.resize(header.action_count);
+        std::memcpy(table.actions.data(), cursor, actions_size);
+        cursor += actions_size;
+        table.bindings.resize(header.binding_count);
+        std::memcpy(table.bindings.data(), cursor, bindings_size);
+        cursor += bindings_size;
+        table.names.assign(reinterpret_cast<const char*>(cursor), header.names_size);
+
+        // Queries index with these without checks, so a corrupt file must not get through.
+        std::uint32_t expected_offset = 0;
+        for (const Action& action : table.actions) {
+            if (action.binding_offset != expected_offset || action.binding_count > header.binding_count - expected_offset) {
+                return fail("binding ranges out of order");
+            }
+            expected_offset += action.binding_count;
+
+            if (action.name_offset > header.names_size || action.name_size > header.names_size - action.name_offset) {
+                return fail("action name out of bounds");
+            }
+            if (action.id != to_action_id(std::string_view { table.names }.substr(action.name_offset, action.name_size))) {
+                return fail("action identifier mismatch");
+            }
+        }
+        if (expected_offset != header.binding_count) return fail("unused bindings");
+
+        for (const CompiledBinding& binding : table.bindings) {
+            const auto kind = static_cast<std::size_t>(binding.kind);
+            if (kind >= MethodFormats.size() || binding.code >= MethodFormats[kind].inputs.size()) {
+                return fail("unknown input");
+            }
+            const bool all_slots = binding.gamepad_slot == CompiledBinding::AllSlots;
+            if (!all_slots && (!MethodFormats[kind].has_slot || binding.gamepad_slot < 0
+                               || binding.gamepad_slot >= static_cast<int>(DeviceManager::MaxGamepadCount))) {
+                return fail("gamepad slot out of range");
+            }
+        }
+        return true;
+    }
+
+    bool InputMap::load_bindings(const std::string_view path) {
+        std::ifstream file { std::string { path }, std::ios::binary | std::ios::ate };
+        if (!file) {
+            Logger::error("Failed to open bindings file: " + std::string { path });
+            return false;
+        }
+
+        // The whole file in a single read, both formats are small.
+        std::vector<std::byte> data(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()))) {
+            Logger::error("Failed to read bindings file: " + std::string { path });
+            return false;
+        }
+
+        BindingTable table;
+        const bool compiled = data.size() >= CompiledMagic.size()
+            && std::memcmp(data.data(), CompiledMagic.data(), CompiledMagic.size()) == 0;
+        const bool read = compiled
+            ? read_compiled_bindings(data, path, table)
+            : parse_bindings({ reinterpret_cast<const char*>(data.data()), data.size() }, path, table);
+
+        return read && replace_bindings(std::move(table));
+    }
+
+    bool InputMap::save_bindings(const std::string_view path) const {
+        std::size_t name_width = 0;
+        for (std::size_t i = 0; i < m_actions.size(); ++i) {
+            const std::string_view name = get_action_name({ static_cast<std::uint32_t>(i) });
+            if (name.empty() || std::ranges::any_of(name, [](const char c) { return is_space(c) || c == '\n' || c == '#'; })) {
+                Logger::error("Action '" + std::string { name } + "' cannot be written to a text bindings file.");
+                return false;
+            }
+            name_width = std::max(name_width, name.size());
+        }
+
+        std::string text = "# <action> <method> <input> [<gamepad slot>]\n";
+        for (std::size_t i = 0; i < m_actions.size(); ++i) {
+            const Action& action = m_actions[i];
+            const std::string_view name = get_action_name({ static_cast<std::uint32_t>(i) });
+
+            for (const CompiledBinding& binding : std::span { m_bindings }.subspan(action.binding_offset, action.binding_count)) {
+                const MethodFormat& method = MethodFormats[static_cast<std::size_t>(binding.kind)];
+
+                text += name;
+                text.append(name_width - name.size() + 2, ' ');
+                text += method.name;
+                text.append(std::string_view { "gamepad_button" }.size() - method.name.size() + 2, ' ');
+                text += method.inputs[binding.code];
+                if (binding.gamepad_slot != CompiledBinding::AllSlots) {
+                    text += ' ';
+                    text += std::to_string(binding.gamepad_slot);
+                }
+                text += '\n';
+            }
+        }
+
+        return write_file_atomically(path, text.data(), text.size());
+    }
+
+    bool InputMap::save_compiled_bindings(const std::string_view path) const {
+        static_assert(std::is_trivially_copyable_v<Action> && sizeof(Action) == 24, "Action is stored as is.");
+        static_assert(std::is_trivially_copyable_v<CompiledBinding> && sizeof(CompiledBinding) == 4, "CompiledBinding is stored as is.");
+
+        const CompiledHeader header {
+            .magic = CompiledMagic,
+            .version = CompiledVersion,
+            .action_count = static_cast<std::uint32_t>(m_actions.size()),
+            .binding_count = static_cast<std::uint32_t>(m_bindings.size()),
+            .names_size = static_cast<std::uint32_t>(m_action_names.size()),
+            .reserved = 0,
+        };
+
+        const std::size_t actions_size = m_actions.size() * sizeof(Action);
+        const std::size_t bindings_size = m_bindings.size() * sizeof(CompiledBinding);
+
+        std::vector<std::byte> data(sizeof(header) + actions_size + bindings_size + m_action_names.size());
+        std::byte* cursor = data.data();
+        std::memcpy(cursor, &header, sizeof(header));
+        cursor += sizeof(header);
+        std::memcpy(cursor, m_actions.data(), actions_size);
+        cursor += actions_size;
+        std::memcpy(cursor, m_bindings.data(), bindings_size);
+        cursor += bindings_size;
+        std::memcpy(cursor, m_action_names.data(), m_action_names.size());
+
+        return write_file_atomically(path, data.data(), data.size());
+    }
+} // vn
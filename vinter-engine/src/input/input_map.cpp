@@ -1,207 +1,320 @@
 #include "vinter/input/input_map.hpp"
 
-#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <span>
+#include <string>
 #include <string_view>
 
 #include "vinter/input/device_manager.hpp"
+#include "vinter/logger.hpp"
 
 namespace vn {
     InputMap::InputMap(DeviceManager& devices)
         : m_devices(devices) {
     }
 
-    void InputMap::bind(const std::string_view action_name, Keyboard::Key key) {
-        m_bindings[to_action_id(action_name)].push_back({ key });
+    ActionHandle InputMap::bind(const std::string_view action_name, Keyboard::Key key) {
+        return add_binding(action_name, { key });
     }
-    void InputMap::bind(const std::string_view action_name, Mouse::Button button) {
-        m_bindings[to_action_id(action_name)].push_back({ button });
+    ActionHandle InputMap::bind(const std::string_view action_name, Mouse::Button button) {
+        return add_binding(action_name, { button });
     }
-    void InputMap::bind(const std::string_view action_name, Mouse::Wheel wheel) {
-        m_bindings[to_action_id(action_name)].push_back({ wheel });
+    ActionHandle InputMap::bind(const std::string_view action_name, Mouse::Wheel wheel) {
+        return add_binding(action_name, { wheel });
     }
-    void InputMap::bind(const std::string_view action_name, Gamepad::Button button) {
-        m_bindings[to_action_id(action_name)].push_back({ button });
+    ActionHandle InputMap::bind(const std::string_view action_name, Gamepad::Button button) {
+        return add_binding(action_name, { button });
     }
-    void InputMap::bind(const std::string_view action_name, Gamepad::Axis axis) {
-        m_bindings[to_action_id(action_name)].push_back({ axis });
+    ActionHandle InputMap::bind(const std::string_view action_name, Gamepad::Axis axis) {
+        return add_binding(action_name, { axis });
     }
-    void InputMap::bind(const std::string_view action_name, Gamepad::Button button, std::size_t slot) {
-        m_bindings[to_action_id(action_name)].push_back({ button, slot});
+    ActionHandle InputMap::bind(const std::string_view action_name, Gamepad::Button button, std::size_t slot) {
+        return add_binding(action_name, { button, slot });
     }
-    void InputMap::bind(const std::string_view action_name, Gamepad::Axis axis, std::size_t slot) {
-        m_bindings[to_action_id(action_name)].push_back({ axis, slot});
+    ActionHandle InputMap::bind(const std::string_view action_name, Gamepad::Axis axis, std::size_t slot) {
+        return add_binding(action_name, { axis, slot });
+    }
+
+    void InputMap::unbind(const std::string_view action_name) {
+        const ActionHandle handle = get_action(action_name);
+        if (!handle.is_valid()) return;
+
+        Action& action = m_actions[handle.index];
+        const auto first = m_bindings.begin() + action.binding_offset;
+        m_bindings.erase(first, first + action.binding_count);
+
+        for (std::size_t i = handle.index + 1; i < m_actions.size(); ++i) {
+            m_actions[i].binding_offset -= action.binding_count;
+        }
+        action.binding_count = 0;
+    }
+
+    std::vector<Binding> InputMap::get_bindings(const ActionHandle action) const {
+        if (action.index >= m_actions.size()) return {};
+
+        const Action& bound = m_actions[action.index];
+        std::vector<Binding> bindings;
+        bindings.reserve(bound.binding_count);
+        for (const CompiledBinding& binding : std::span { m_bindings }.subspan(bound.binding_offset, bound.binding_count)) {
+            bindings.push_back(decompile_binding(binding));
+        }
+        return bindings;
+    }
+
+    std::string_view InputMap::get_action_name(const ActionHandle action) const {
+        if (action.index >= m_actions.size()) return {};
+
+        return std::string_view { m_action_names }.substr(m_actions[action.index].name_offset, m_actions[action.index].name_size);
+    }
+
+    ActionHandle InputMap::get_action(const std::string_view action_name) const {
+        return get_action(to_action_id(action_name));
+    }
+    ActionHandle InputMap::get_action(const ActionID id) const {
+        if (const auto it = m_action_lookup.find(id); it != m_action_lookup.end()) {
+            return { it->second };
+        }
+        return {};
     }
 
     bool InputMap::is_action_pressed(const std::string_view action_name) const {
-        return check_action_pressed_state(action_name, PressedState::Pressed);
+        return check_action_pressed_state(get_action(action_name), PressedState::Pressed);
     }
     bool InputMap::is_action_just_pressed(const std::string_view action_name) const {
-        return check_action_pressed_state(action_name, PressedState::JustPressed);
+        return check_action_pressed_state(get_action(action_name), PressedState::JustPressed);
     }
     bool InputMap::is_action_just_released(const std::string_view action_name) const {
-        return check_action_pressed_state(action_name, PressedState::JustReleased);
+        return check_action_pressed_state(get_action(action_name), PressedState::JustReleased);
     }
     float InputMap::get_action_strength(const std::string_view action_name) const {
-        const auto it = m_bindings.find(to_action_id(action_name));
-        if (it == m_bindings.end()) return 0.f;
+        return get_action_strength(get_action(action_name));
+    }
 
-        float max_strength = 0.f;
-        for (const Binding& binding : it->second) {
-            max_strength = std::max(max_strength, evaluate_input_strength(binding));
-        }
-        return max_strength;
+    bool InputMap::is_action_pressed(const ActionHandle action) const {
+        return check_action_pressed_state(action, PressedState::Pressed);
+    }
+    bool InputMap::is_action_just_pressed(const ActionHandle action) const {
+        return check_action_pressed_state(action, PressedState::JustPressed);
+    }
+    bool InputMap::is_action_just_released(const ActionHandle action) const {
+        return check_action_pressed_state(action, PressedState::JustReleased);
+    }
+    float InputMap::get_action_strength(const ActionHandle action) const {
+        if (action.index >= m_action_states.size()) return 0.f;
+        return m_action_states[action.index].strength;
     }
 
-    bool InputMap::check_action_pressed_state(const std::string_view action_name, const PressedState state) const {
-        const auto it = m_bindings.find(to_action_id(action_name));
-        if (it == m_bindings.end()) return false;
+    InputMap::CompiledBinding InputMap::compile_binding(const Binding& binding) noexcept {
+        assert((!binding.gamepad_slot || *binding.gamepad_slot < DeviceManager::MaxGamepadCount) &&
+               "Gamepad slot out of range.");
 
-        for (const Binding& binding : it->second) {
-            if (evaluate_binding_pressed(binding, state)) {
-                return true;
-            }
-        }
-        return false;
-    }
+        const std::int8_t slot = binding.gamepad_slot
+            ? static_cast<std::int8_t>(*binding.gamepad_slot)
+            : CompiledBinding::AllSlots;
 
-    bool InputMap::evaluate_binding_pressed(const Binding& binding, const PressedState state) const {
-        return std::visit([&]<typename T>(T input_visitor) -> bool {
+        return std::visit([&]<typename T>(T input_method) -> CompiledBinding {
             using InputT = std::decay_t<T>;
+            const auto code = static_cast<std::uint16_t>(input_method);
 
             if constexpr (std::is_same_v<InputT, Keyboard::Key>) {
-                return evaluate_key_pressed_state(input_visitor, state);
+                return { CompiledBinding::Kind::Key, CompiledBinding::AllSlots, code };
             } else if constexpr (std::is_same_v<InputT, Mouse::Button>) {
-                return evaluate_mouse_button_pressed_state(input_visitor, state);
+                return { CompiledBinding::Kind::MouseButton, CompiledBinding::AllSlots, code };
             } else if constexpr (std::is_same_v<InputT, Mouse::Wheel>) {
-                return evaluate_mouse_wheel_pressed_state(input_visitor, state);
+                return { CompiledBinding::Kind::MouseWheel, CompiledBinding::AllSlots, code };
             } else if constexpr (std::is_same_v<InputT, Gamepad::Button>) {
-                return evaluate_gamepad_button_pressed_state(input_visitor, binding, state);
+                return { CompiledBinding::Kind::GamepadButton, slot, code };
             } else if constexpr (std::is_same_v<InputT, Gamepad::Axis>) {
-               return evaluate_gamepad_axis_pressed_state(input_visitor, binding, state);
+                return { CompiledBinding::Kind::GamepadAxis, slot, code };
             }
         }, binding.input_method);
     }
 
-    float InputMap::evaluate_input_strength(const Binding& binding) const {
-        return std::visit([&]<typename T>(T input_val) -> float {
-            using InputT = std::decay_t<T>;
+    Binding InputMap::decompile_binding(const CompiledBinding& binding) noexcept {
+        const std::optional<std::size_t> slot = binding.gamepad_slot != CompiledBinding::AllSlots
+            ? std::optional<std::size_t> { static_cast<std::size_t>(binding.gamepad_slot) }
+            : std::nullopt;
 
-            if constexpr (std::is_same_v<InputT, Keyboard::Key>) {
-                return m_devices.get_keyboard().is_key_pressed(input_val) ? 1.f : 0.f;
-            } else if constexpr (std::is_same_v<InputT, Mouse::Button>) {
-                return m_devices.get_mouse().is_button_pressed(input_val) ? 1.f : 0.f;
-            } else if constexpr (std::is_same_v<InputT, Mouse::Wheel>) {
-                return m_devices.get_mouse().is_wheel_triggered(input_val) ? 1.f : 0.f;
-            } else if constexpr (std::is_same_v<InputT, Gamepad::Button>) {
-                if (binding.gamepad_slot) {
-                    auto* g = m_devices.get_gamepad(*binding.gamepad_slot);
-                    if (!g) return 0.f; // SAFE
-                    return g->is_button_pressed(input_val) ? 1.f : 0.f;
-                }
-                float max_strength = 0.f;
-                for (auto* g : m_devices.get_gamepads()) {
-                    if (!g) continue;
-                    max_strength = std::max(max_strength, g->is_button_pressed(input_val) ? 1.f : 0.f);
-                }
-                return max_strength;
-            } else if constexpr (std::is_same_v<InputT, Gamepad::Axis>) {
-                if (binding.gamepad_slot) {
-                    auto* g = m_devices.get_gamepad(*binding.gamepad_slot);
-                    if (!g) return 0.f; // SAFE
-                    return g->get_axis_strength(input_val);
-                }
-                float max_strength = 0.f;
-                for (auto* g : m_devices.get_gamepads()) {
-                    if (!g) continue;
-                    max_strength = std::max(max_strength, g->get_axis_strength(input_val));
-                }
-                return max_strength;
-            }
-        }, binding.input_method);
+        switch (binding.kind) {
+            case CompiledBinding::Kind::Key:           return { static_cast<Keyboard::Key>(binding.code) };
+            case CompiledBinding::Kind::MouseButton:   return { static_cast<Mouse::Button>(binding.code) };
+            case CompiledBinding::Kind::MouseWheel:    return { static_cast<Mouse::Wheel>(binding.code) };
+            case CompiledBinding::Kind::GamepadButton: return { static_cast<Gamepad::Button>(binding.code), slot };
+            case CompiledBinding::Kind::GamepadAxis:   return { static_cast<Gamepad::Axis>(binding.code), slot };
+        }
+        return {};
     }
 
-    bool InputMap::evaluate_key_pressed_state(const Keyboard::Key key, const PressedState state) const {
-        switch (state) {
-            case PressedState::Pressed: return m_devices.get_keyboard().is_key_pressed(key);
-            case PressedState::JustPressed: return m_devices.get_keyboard().is_key_just_pressed(key);
-            case PressedState::JustReleased: return m_devices.get_keyboard().is_key_just_released(key);
+    ActionHandle InputMap::add_binding(const std::string_view action_name, const Binding& binding) {
+        const ActionID id = to_action_id(action_name);
+
+        auto [it, inserted] = m_action_lookup.try_emplace(id, static_cast<std::uint32_t>(m_actions.size()));
+        if (inserted) {
+            m_actions.push_back({
+                id, static_cast<std::uint32_t>(m_bindings.size()), 0,
+                static_cast<std::uint32_t>(m_action_names.size()), static_cast<std::uint32_t>(action_name.size())
+            });
+            m_action_states.emplace_back();
+            m_action_names += action_name;
         }
-        return false;
-    }
 
-    bool InputMap::evaluate_mouse_button_pressed_state(const Mouse::Button button, const PressedState state) const {
-        switch (state) {
-            case PressedState::Pressed: return m_devices.get_mouse().is_button_pressed(button);
-            case PressedState::JustPressed: return m_devices.get_mouse().is_button_just_pressed(button);
-            case PressedState::JustReleased: return m_devices.get_mouse().is_button_just_released(button);
+        // Keep each action's bindings contiguous by inserting at the end of its range and shifting the
+        // ranges of all later actions. Binding is rare, querying is not.
+        const std::uint32_t index = it->second;
+        Action& action = m_actions[index];
+        m_bindings.insert(
+            m_bindings.begin() + action.binding_offset + action.binding_count,
+            compile_binding(binding)
+        );
+        ++action.binding_count;
+
+        for (std::size_t i = index + 1; i < m_actions.size(); ++i) {
+            ++m_actions[i].binding_offset;
         }
-        return false;
+        return { index };
     }
 
-    bool InputMap::evaluate_mouse_wheel_pressed_state(const Mouse::Wheel wheel, const PressedState state) const {
-        switch (state) {
-            case PressedState::JustPressed:
-                return m_devices.get_mouse().is_wheel_triggered(wheel);
-            case PressedState::Pressed:
-            case PressedState::JustReleased:
+    bool InputMap::replace_bindings(BindingTable&& table) {
+        std::unordered_map<ActionID, std::uint32_t> lookup;
+        lookup.reserve(table.actions.size());
+        for (std::uint32_t i = 0; i < table.actions.size(); ++i) {
+            if (!lookup.try_emplace(table.actions[i].id, i).second) {
+                Logger::error("Duplicate action in bindings: " + std::string {
+                    std::string_view { table.names }.substr(table.actions[i].name_offset, table.actions[i].name_size)
+                });
                 return false;
+            }
+        }
+
+        // Nothing to keep in place, the table becomes the map's as is.
+        if (m_actions.empty()) {
+            m_actions = std::move(table.actions);
+            m_bindings = std::move(table.bindings);
+            m_action_names = std::move(table.names);
+            m_action_lookup = std::move(lookup);
+            m_action_states.assign(m_actions.size(), {});
+            return true;
         }
-        return false;
-    }
-
-    bool InputMap::evaluate_gamepad_button_pressed_state(
-        const Gamepad::Button button,
-        const Binding& binding,
-        const PressedState state
-    ) const {
-        // Check slot specific pressed state.
-        if (binding.gamepad_slot) {
-            const auto* gamepad = m_devices.get_gamepad(*binding.gamepad_slot);
-            if (!gamepad) return false;
-            switch (state) {
-                case PressedState::Pressed: return gamepad->is_button_pressed(button);
-                case PressedState::JustPressed: return gamepad->is_button_just_pressed(button);
-                case PressedState::JustReleased: return gamepad->is_button_just_released(button);
+
+        // Registered actions keep their index, so that resolved handles stay valid; new ones are appended.
+        std::vector<const Action*> sources(m_actions.size(), nullptr);
+        for (const Action& action : table.actions) {
+            auto [it, inserted] = m_action_lookup.try_emplace(action.id, static_cast<std::uint32_t>(m_actions.size()));
+            if (inserted) {
+                m_actions.push_back({
+                    action.id, 0, 0,
+                    static_cast<std::uint32_t>(m_action_names.size()), action.name_size
+                });
+                m_action_names.append(table.names, action.name_offset, action.name_size);
+                sources.push_back(&action);
+            } else {
+                sources[it->second] = &action;
             }
-        // Check all gamepads for pressed state.
-        } else {
-            for (const auto* gamepad : m_devices.get_gamepads()) {
-                if (!gamepad) continue;
-                switch (state) {
-                    case PressedState::Pressed: if (gamepad->is_button_pressed(button)) return true;
-                    case PressedState::JustPressed: if (gamepad->is_button_just_pressed(button)) return true;
-                    case PressedState::JustReleased: if (gamepad->is_button_just_released(button)) return true;
-                }
+        }
+
+        m_bindings.clear();
+        for (std::size_t i = 0; i < m_actions.size(); ++i) {
+            m_actions[i].binding_offset = static_cast<std::uint32_t>(m_bindings.size());
+            m_actions[i].binding_count = sources[i] ? sources[i]->binding_count : 0;
+            if (sources[i]) {
+                const auto first = table.bindings.begin() + sources[i]->binding_offset;
+                m_bindings.insert(m_bindings.end(), first, first + sources[i]->binding_count);
+            }
+        }
+        m_action_states.resize(m_actions.size());
+        return true;
+    }
+
+    void InputMap::update() {
+        // Resolve the gamepad slots once, rather than once per gamepad binding.
+        const GamepadSlots gamepads = m_devices.get_gamepads();
+
+        for (std::size_t i = 0; i < m_actions.size(); ++i) {
+            const Action& action = m_actions[i];
+
+            ActionState state {};
+            for (const CompiledBinding& binding : std::span { m_bindings }.subspan(action.binding_offset, action.binding_count)) {
+                state.merge(resolve_binding(binding, gamepads));
             }
+            m_action_states[i] = state;
         }
-        return false;
-    }
-
-    bool InputMap::evaluate_gamepad_axis_pressed_state(
-        const Gamepad::Axis axis,
-        const Binding& binding,
-        const PressedState state
-    ) const {
-        // Check slot specific pressed state.
-        if (binding.gamepad_slot) {
-            const auto* gamepad = m_devices.get_gamepad(*binding.gamepad_slot);
-            if (!gamepad) return false;
-            switch (state) {
-                case PressedState::Pressed: return gamepad->is_axis_pressed(axis);
-                case PressedState::JustPressed: return gamepad->is_axis_just_pressed(axis);
-                case PressedState::JustReleased: return gamepad->is_axis_just_released(axis);
+    }
+
+    bool InputMap::check_action_pressed_state(const ActionHandle action, const PressedState state) const {
+        if (action.index >= m_action_states.size()) return false;
+        return (m_action_states[action.index].pressed_states & static_cast<std::uint8_t>(state)) != 0;
+    }
+
+    static std::uint8_t to_pressed_states(const bool pressed, const bool just_pressed, const bool just_released) {
+        return static_cast<std::uint8_t>(pressed | just_pressed << 1 | just_released << 2);
+    }
+
+    InputMap::ActionState InputMap::resolve_binding(const CompiledBinding& binding, const GamepadSlots& gamepads) const {
+        switch (binding.kind) {
+            case CompiledBinding::Kind::Key: {
+                const auto& keyboard = m_devices.get_keyboard();
+                const auto key = static_cast<Keyboard::Key>(binding.code);
+                const bool pressed = keyboard.is_key_pressed(key);
+                return {
+                    to_pressed_states(pressed, keyboard.is_key_just_pressed(key), keyboard.is_key_just_released(key)),
+                    pressed ? 1.f : 0.f
+                };
+            }
+            case CompiledBinding::Kind::MouseButton: {
+                const auto& mouse = m_devices.get_mouse();
+                const auto button = static_cast<Mouse::Button>(binding.code);
+                const bool pressed = mouse.is_button_pressed(button);
+                return {
+                    to_pressed_states(pressed, mouse.is_button_just_pressed(button), mouse.is_button_just_released(button)),
+                    pressed ? 1.f : 0.f
+                };
+            }
+            case CompiledBinding::Kind::MouseWheel: {
+                // A wheel scroll is a single-frame event, so it only ever reports as just pressed.
+                const bool triggered = m_devices.get_mouse().is_wheel_triggered(static_cast<Mouse::Wheel>(binding.code));
+                return { to_pressed_states(false, triggered, false), triggered ? 1.f : 0.f };
             }
-            // Check all gamepads for pressed state.
-        } else {
-            for (const auto* gamepad : m_devices.get_gamepads()) {
-                if (!gamepad) continue;
-                switch (state) {
-                    case PressedState::Pressed: if (gamepad->is_axis_pressed(axis)) return true;
-                    case PressedState::JustPressed: if (gamepad->is_axis_just_pressed(axis)) return true;
-                    case PressedState::JustReleased: if (gamepad->is_axis_just_released(axis)) return true;
+            case CompiledBinding::Kind::GamepadButton: {
+                const auto button = static_cast<Gamepad::Button>(binding.code);
+                if (binding.gamepad_slot != CompiledBinding::AllSlots) {
+                    const auto* gamepad = gamepads[binding.gamepad_slot];
+                    return gamepad ? resolve_gamepad_button(*gamepad, button) : ActionState {};
                 }
+                ActionState state {};
+                for (const auto* gamepad : gamepads) {
+                    if (gamepad) state.merge(resolve_gamepad_button(*gamepad, button));
+                }
+                return state;
+            }
+            case CompiledBinding::Kind::GamepadAxis: {
+                const auto axis = static_cast<Gamepad::Axis>(binding.code);
+                if (binding.gamepad_slot != CompiledBinding::AllSlots) {
+                    const auto* gamepad = gamepads[binding.gamepad_slot];
+                    return gamepad ? resolve_gamepad_axis(*gamepad, axis) : ActionState {};
+                }
+                ActionState state {};
+                for (const auto* gamepad : gamepads) {
+                    if (gamepad) state.merge(resolve_gamepad_axis(*gamepad, axis));
+                }
+                return state;
             }
         }
-        return false;
+        return {};
+    }
+
+    InputMap::ActionState InputMap::resolve_gamepad_button(const Gamepad& gamepad, const Gamepad::Button button) {
+        const bool pressed = gamepad.is_button_pressed(button);
+        return {
+            to_pressed_states(pressed, gamepad.is_button_just_pressed(button), gamepad.is_button_just_released(button)),
+            pressed ? 1.f : 0.f
+        };
+    }
+
+    InputMap::ActionState InputMap::resolve_gamepad_axis(const Gamepad& gamepad, const Gamepad::Axis axis) {
+        return {
+            to_pressed_states(gamepad.is_axis_pressed(axis), gamepad.is_axis_just_pressed(axis), gamepad.is_axis_just_released(axis)),
+            gamepad.get_axis_strength(axis)
+        };
     }
-} // vn;
\ No newline at end of file
+} // vn
@@ -0,0 +1,127 @@
+#include "input_recording.hpp"
+
+#include <bit>
+#include <string>
+
+namespace vn {
+    namespace {
+        constexpr std::array<char, 4> Magic { 'V', 'N', 'I', 'R' };
+        constexpr std::uint32_t Version { 1 };
+
+        constexpr std::size_t ChunkCount { sizeof(DeviceSnapshot) / sizeof(std::uint64_t) };
+        constexpr std::size_t MaskWordCount { (ChunkCount + 63) / 64 };
+
+        using Chunks = std::array<std::uint64_t, ChunkCount>;
+
+        Chunks to_chunks(const DeviceSnapshot& snapshot) {
+            return std::bit_cast<Chunks>(snapshot);
+        }
+
+        void write_varint(std::vector<std::uint8_t>& buffer, std::uint64_t value) {
+            while (value >= 0x80) {
+                buffer.push_back(static_cast<std::uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            buffer.push_back(static_cast<std::uint8_t>(value));
+        }
+
+        bool read_varint(std::istream& in, std::uint64_t& value) {
+            value = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                const int byte = in.get();
+                if (byte == std::char_traits<char>::eof()) return false;
+
+                value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) return true;
+            }
+            return false;
+        }
+
+        template<typename T>
+        void write_raw(std::vector<std::uint8_t>& buffer, const T& value) {
+            const auto* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        template<typename T>
+        bool read_raw(std::istream& in, T& value) {
+            return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+    }
+
+    InputRecordWriter::InputRecordWriter(const std::string_view path)
+        : m_file(std::string { path }, std::ios::binary | std::ios::trunc) {
+        if (!m_file) return;
+
+        m_buffer.reserve(sizeof(Magic) + 2 * sizeof(std::uint32_t));
+        write_raw(m_buffer, Magic);
+        write_raw(m_buffer, Version);
+        write_raw(m_buffer, static_cast<std::uint32_t>(sizeof(DeviceSnapshot)));
+        m_file.write(reinterpret_cast<const char*>(m_buffer.data()), static_cast<std::streamsize>(m_buffer.size()));
+    }
+
+    bool InputRecordWriter::is_open() const {
+        return m_file.is_open() && m_file.good();
+    }
+
+    void InputRecordWriter::write_frame(const float delta, const DeviceSnapshot& snapshot) {
+        const Chunks current = to_chunks(snapshot);
+        const Chunks previous = to_chunks(m_previous);
+
+        std::array<std::uint64_t, MaskWordCount> mask {};
+        for (std::size_t i = 0; i < ChunkCount; ++i) {
+            if (current[i] != previous[i]) mask[i / 64] |= std::uint64_t { 1 } << (i % 64);
+        }
+
+        m_buffer.clear();
+        write_raw(m_buffer, delta);
+        for (const std::uint64_t word : mask) {
+            write_varint(m_buffer, word);
+        }
+        for (std::size_t i = 0; i < ChunkCount; ++i) {
+            if (current[i] != previous[i]) write_raw(m_buffer, current[i] ^ previous[i]);
+        }
+
+        m_file.write(reinterpret_cast<const char*>(m_buffer.data()), static_cast<std::streamsize>(m_buffer.size()));
+        m_previous = snapshot;
+    }
+
+    InputRecordReader::InputRecordReader(const std::string_view path)
+        : m_file(std::string { path }, std::ios::binary) {
+        std::array<char, 4> magic {};
+        std::uint32_t version = 0;
+        std::uint32_t snapshot_size = 0;
+
+        if (!read_raw(m_file, magic) || !read_raw(m_file, version) || !read_raw(m_file, snapshot_size) ||
+            magic != Magic || version != Version || snapshot_size != sizeof(DeviceSnapshot)) {
+            m_file.close();
+        }
+    }
+
+    bool InputRecordReader::is_open() const {
+        return m_file.is_open();
+    }
+
+    bool InputRecordReader::read_frame(float& delta, DeviceSnapshot& snapshot) {
+        if (!m_file.is_open() || !read_raw(m_file, delta)) return false;
+
+        std::array<std::uint64_t, MaskWordCount> mask {};
+        for (std::uint64_t& word : mask) {
+            if (!read_varint(m_file, word)) return false;
+        }
+
+        Chunks chunks = to_chunks(m_current);
+        for (std::size_t m = 0; m < MaskWordCount; ++m) {
+            for (std::uint64_t bits = mask[m]; bits != 0; bits &= bits - 1) {
+                const std::size_t i = m * 64 + std::countr_zero(bits);
+                std::uint64_t difference;
+                if (i >= ChunkCount || !read_raw(m_file, difference)) return false;
+                chunks[i] ^= difference;
+            }
+        }
+
+        m_current = std::bit_cast<DeviceSnapshot>(chunks);
+        snapshot = m_current;
+        return true;
+    }
+} // vn
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <SDL3/SDL.h>
+
+#include "vinter/input/button_states.hpp"
+#include "vinter/input/device_manager.hpp"
+#include "vinter/input/gamepad.hpp"
+
+namespace vn {
+    /**
+     * The latched state of a ButtonStates, without the event state pending for the next frame.
+     */
+    template<std::size_t N>
+    struct ButtonSnapshot {
+        std::array<std::uint64_t, ButtonStates<N>::WordCount> current {};
+        std::array<std::uint64_t, ButtonStates<N>::WordCount> pressed_edges {};
+        std::array<std::uint64_t, ButtonStates<N>::WordCount> released_edges {};
+
+        void save(const ButtonStates<N>& states) {
+            current = states.current;
+            pressed_edges = states.pressed_edges;
+            released_edges = states.released_edges;
+        }
+
+        void load(ButtonStates<N>& states) const {
+            states.previous = states.current;
+            states.current = current;
+            states.pressed_edges = pressed_edges;
+            states.released_edges = released_edges;
+            states.pending = current;
+            states.pending_pressed_edges = {};
+            states.pending_released_edges = {};
+        }
+    };
+
+    struct KeyboardSnapshot {
+        ButtonSnapshot<SDL_SCANCODE_COUNT> keys;
+    };
+
+    struct MouseSnapshot {
+        ButtonSnapshot<5> buttons;
+        float position_x, position_y;
+        float scroll_x, scroll_y;
+    };
+
+    struct GamepadSnapshot {
+        std::uint64_t connected;
+        ButtonSnapshot<SDL_GAMEPAD_BUTTON_COUNT> buttons;
+        std::array<float, static_cast<std::size_t>(Gamepad::Axis::Count)> axes;
+    };
+
+    /**
+     * The state of every device after a DeviceManager update, as recorded and replayed.
+     */
+    struct DeviceSnapshot {
+        KeyboardSnapshot keyboard {};
+        MouseSnapshot mouse {};
+        std::array<GamepadSnapshot, DeviceManager::MaxGamepadCount> gamepads {};
+    };
+
+    static_assert(std::is_trivially_copyable_v<DeviceSnapshot>);
+    static_assert(sizeof(DeviceSnapshot) % sizeof(std::uint64_t) == 0, "Snapshots are delta encoded in 64-bit chunks.");
+
+    /**
+     * Writes device snapshots and frame deltas to a binary input recording.
+     *
+     * Each frame is stored as its delta time followed by the snapshot XORed against the previous frame's,
+     * of which only the non-zero 64-bit chunks are written, after a bitmask of which chunks those are.
+     * An idle frame therefore costs a handful of bytes.
+     */
+    class InputRecordWriter {
+    public:
+        explicit InputRecordWriter(std::string_view path);
+
+        [[nodiscard]] bool is_open() const;
+        void write_frame(float delta, const DeviceSnapshot& snapshot);
+
+    private:
+        std::ofstream m_file;
+        DeviceSnapshot m_previous {};
+        std::vector<std::uint8_t> m_buffer;
+    };
+
+    /**
+     * Reads back the frames of a binary input recording written by InputRecordWriter.
+     */
+    class InputRecordReader {
+    public:
+        explicit InputRecordReader(std::string_view path);
+
+        [[nodiscard]] bool is_open() const;
+
+        /**
+         * Decodes the next frame.
+         *
+         * @return `false` at the end of the recording or on a truncated frame.
+         */
+        bool read_frame(float& delta, DeviceSnapshot& snapshot);
+
+    private:
+        std::ifstream m_file;
+        DeviceSnapshot m_current {};
+    };
+} // vn
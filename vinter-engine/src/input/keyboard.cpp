@@ -1,13 +1,17 @@
 #include "vinter/input/keyboard.hpp"
 
+#include <array>
+#include <cstdint>
+
 #include <SDL3/SDL.h>
 
 #include "vinter/input/button_states.hpp"
+#include "input_recording.hpp"
 
 namespace vn {
     struct Keyboard::Impl {
-        const bool* sdl_state { SDL_GetKeyboardState(nullptr) };
         ButtonStates<SDL_SCANCODE_COUNT> key_states {};
+        std::array<std::uint64_t, SDL_SCANCODE_COUNT> key_timestamps {};
 
         static SDL_Scancode to_sdl_scancode(const Key key) {
             switch (key) {
@@ -125,10 +129,32 @@ namespace vn {
                 case Key::Pause:       return SDL_SCANCODE_PAUSE;
             }
         }
+
+        static constexpr std::int16_t NoKey { -1 };
+
+        static const std::array<std::int16_t, SDL_SCANCODE_COUNT>& scancode_to_key() {
+            static const auto table = [] {
+                std::array<std::int16_t, SDL_SCANCODE_COUNT> result;
+                result.fill(NoKey);
+                for (int i = 0; i <= static_cast<int>(Key::Pause); ++i) {
+                    if (const SDL_Scancode scancode = to_sdl_scancode(static_cast<Key>(i)); scancode != SDL_SCANCODE_UNKNOWN) {
+                        result[scancode] = static_cast<std::int16_t>(i);
+                    }
+                }
+                return result;
+            }();
+            return table;
+        }
     };
 
     Keyboard::Keyboard()
         : m_impl(std::make_unique<Impl>()) {
+        // Seed keys already held at startup, after which the state is driven by key events.
+        const bool* sdl_state = SDL_GetKeyboardState(nullptr);
+        for (std::size_t i = 0; i < SDL_SCANCODE_COUNT; i++) {
+            if (sdl_state[i]) m_impl->key_states.press(i);
+        }
+        m_impl->key_states.latch();
     }
 
     Keyboard::~Keyboard() = default;
@@ -143,15 +169,52 @@ namespace vn {
         return m_impl->key_states.is_just_released(Impl::to_sdl_scancode(key));
     }
 
+    bool Keyboard::is_any_key_pressed() const {
+        return m_impl->key_states.is_any_pressed();
+    }
+    bool Keyboard::is_any_key_just_pressed() const {
+        return m_impl->key_states.is_any_just_pressed();
+    }
+    std::uint64_t Keyboard::get_key_timestamp(const Key key) const {
+        return m_impl->key_timestamps[Impl::to_sdl_scancode(key)];
+    }
+
+    std::size_t Keyboard::get_pressed_key_count() const {
+        return m_impl->key_states.count_pressed();
+    }
+    std::pmr::vector<Keyboard::Key> Keyboard::get_just_pressed_keys(std::pmr::memory_resource* resource) const {
+        const auto& table = Impl::scancode_to_key();
+
+        std::pmr::vector<Key> result { resource };
+        m_impl->key_states.for_each_just_pressed([&](const std::size_t scancode) {
+            if (table[scancode] != Impl::NoKey) {
+                result.push_back(static_cast<Key>(table[scancode]));
+            }
+        });
+        return result;
+    }
+
     void Keyboard::handle_events(const SDL_Event& event) {
+        if (event.type != SDL_EVENT_KEY_DOWN && event.type != SDL_EVENT_KEY_UP) return;
+        if (event.key.repeat || event.key.scancode >= SDL_SCANCODE_COUNT) return;
+
+        if (event.key.down) {
+            m_impl->key_states.press(event.key.scancode);
+        } else {
+            m_impl->key_states.release(event.key.scancode);
+        }
+        m_impl->key_timestamps[event.key.scancode] = event.key.timestamp;
     }
 
     void Keyboard::update() {
-        m_impl->key_states.refresh();
+        m_impl->key_states.latch();
+    }
 
-        // Synchronize with actual sdl state.
-        for (std::size_t i = 0; i < SDL_SCANCODE_COUNT; i++) {
-            m_impl->key_states.current[i] = m_impl->sdl_state[i];
-        }
+    void Keyboard::save_snapshot(KeyboardSnapshot& snapshot) const {
+        snapshot.keys.save(m_impl->key_states);
+    }
+
+    void Keyboard::load_snapshot(const KeyboardSnapshot& snapshot) {
+        snapshot.keys.load(m_impl->key_states);
     }
 } // vn
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include <SDL3/SDL.h>
 
+#include "input_recording.hpp"
+
 namespace vn {
     static std::size_t to_sdl_mouse_button(Mouse::Button button) {
         return static_cast<std::size_t>(button);
@@ -55,20 +57,37 @@ namespace vn {
 
     void Mouse::handle_events(const SDL_Event& event) {
         if (event.type == SDL_EVENT_MOUSE_WHEEL) {
-            m_scroll += glm::vec2(event.wheel.x, event.wheel.y);
+            m_scroll_pending += glm::vec2(event.wheel.x, event.wheel.y);
         }
     }
 
     void Mouse::update() {
         m_buttons.refresh();
         m_position_previous = m_position;
-        m_scroll = { 0.f, 0.f };
+        // Latch the scroll accumulated since the last update, so it holds for the whole frame.
+        m_scroll = m_scroll_pending;
+        m_scroll_pending = { 0.f, 0.f };
 
         const SDL_MouseButtonFlags sdl_buttons = SDL_GetMouseState(&m_position.x, &m_position.y);
-        m_buttons.current[0] = (sdl_buttons & SDL_BUTTON_LMASK)  != 0;
-        m_buttons.current[1] = (sdl_buttons & SDL_BUTTON_RMASK)  != 0;
-        m_buttons.current[2] = (sdl_buttons & SDL_BUTTON_MMASK)  != 0;
-        m_buttons.current[3] = (sdl_buttons & SDL_BUTTON_X1MASK) != 0;
-        m_buttons.current[4] = (sdl_buttons & SDL_BUTTON_X2MASK) != 0;
+        m_buttons.set(0, (sdl_buttons & SDL_BUTTON_LMASK)  != 0);
+        m_buttons.set(1, (sdl_buttons & SDL_BUTTON_RMASK)  != 0);
+        m_buttons.set(2, (sdl_buttons & SDL_BUTTON_MMASK)  != 0);
+        m_buttons.set(3, (sdl_buttons & SDL_BUTTON_X1MASK) != 0);
+        m_buttons.set(4, (sdl_buttons & SDL_BUTTON_X2MASK) != 0);
+    }
+
+    void Mouse::save_snapshot(MouseSnapshot& snapshot) const {
+        snapshot.buttons.save(m_buttons);
+        snapshot.position_x = m_position.x;
+        snapshot.position_y = m_position.y;
+        snapshot.scroll_x = m_scroll.x;
+        snapshot.scroll_y = m_scroll.y;
+    }
+
+    void Mouse::load_snapshot(const MouseSnapshot& snapshot) {
+        snapshot.buttons.load(m_buttons);
+        m_position_previous = m_position;
+        m_position = { snapshot.position_x, snapshot.position_y };
+        m_scroll = { snapshot.scroll_x, snapshot.scroll_y };
     }
 } // vn
\ No newline at end of file
@@ -0,0 +1,248 @@
+#include "vinter/job_system.hpp"
+
+#include <array>
+#include <cassert>
+#include <string>
+#include <thread>
+
+#include "vinter/settings/job_settings.hpp"
+#include "vinter/profiler.hpp"
+
+namespace vn {
+    namespace {
+        /**
+         * Bounded Chase-Lev deque: the owning worker pushes and pops at the bottom, thieves steal from the top.
+         */
+        class WorkStealingQueue {
+        public:
+            static constexpr std::size_t Capacity { JobSystem::JobsPerThread };
+            static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+
+            bool push(Job* job) noexcept {
+                const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+                const std::int64_t top = m_top.load(std::memory_order_acquire);
+                if (bottom - top >= static_cast<std::int64_t>(Capacity)) return false;
+
+                m_buffer[bottom & Mask].store(job, std::memory_order_relaxed);
+                m_bottom.store(bottom + 1, std::memory_order_release);
+                return true;
+            }
+
+            Job* pop() noexcept {
+                const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+                m_bottom.store(bottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                std::int64_t top = m_top.load(std::memory_order_relaxed);
+
+                if (top > bottom) {
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+
+                Job* job = m_buffer[bottom & Mask].load(std::memory_order_relaxed);
+                if (top == bottom) {
+                    // Last job, race thieves for it.
+                    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                        job = nullptr;
+                    }
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                }
+                return job;
+            }
+
+            Job* steal() noexcept {
+                std::int64_t top = m_top.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+                if (top >= bottom) return nullptr;
+
+                Job* job = m_buffer[top & Mask].load(std::memory_order_relaxed);
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    return nullptr;
+                }
+                return job;
+            }
+
+        private:
+            static constexpr std::int64_t Mask { static_cast<std::int64_t>(Capacity) - 1 };
+
+            alignas(64) std::atomic<std::int64_t> m_top { 0 };
+            alignas(64) std::atomic<std::int64_t> m_bottom { 0 };
+            std::array<std::atomic<Job*>, Capacity> m_buffer {};
+        };
+
+        struct Worker {
+            WorkStealingQueue queue;
+            // Jobs are recycled in order; a slot still in use is waited on before being handed out again.
+            std::unique_ptr<Job[]> jobs { new Job[JobSystem::JobsPerThread] };
+            std::size_t next_job { 0 };
+            std::uint32_t random_state { 0 };
+            std::thread thread;
+        };
+
+        thread_local Worker* t_worker { nullptr };
+    }
+
+    struct JobSystem::Impl {
+        std::vector<std::unique_ptr<Worker>> workers; // Index 0 is the main thread.
+        std::atomic<std::uint32_t> work_signal { 0 };
+        std::atomic<bool> stop_requested { false };
+
+        Worker& get_current_worker() const noexcept {
+            assert(t_worker && "Jobs can only be scheduled from the main thread or from within jobs.");
+            return *t_worker;
+        }
+
+        Job* find_job(Worker& worker) noexcept {
+            if (Job* job = worker.queue.pop()) return job;
+
+            // Steal from a random victim, then from every other worker in turn.
+            const std::size_t count = workers.size();
+            if (count < 2) return nullptr;
+
+            worker.random_state ^= worker.random_state << 13;
+            worker.random_state ^= worker.random_state >> 17;
+            worker.random_state ^= worker.random_state << 5;
+
+            const std::size_t start = worker.random_state % count;
+            for (std::size_t i = 0; i < count; ++i) {
+                Worker& victim = *workers[(start + i) % count];
+                if (&victim == &worker) continue;
+                if (Job* job = victim.queue.steal()) return job;
+            }
+            return nullptr;
+        }
+
+        void push(Worker& worker, Job* job) {
+            if (!worker.queue.push(job)) {
+                // The deque is full, run the job right away rather than dropping it.
+                execute(worker, job);
+                return;
+            }
+            work_signal.fetch_add(1, std::memory_order_release);
+            work_signal.notify_one();
+        }
+
+        void execute(Worker& worker, Job* job) {
+            job->m_invoke(*job);
+
+            JobCounter& counter = *job->m_counter;
+            job->m_in_use.store(false, std::memory_order_release);
+
+            counter.m_finishing.fetch_add(1, std::memory_order_seq_cst);
+            if (counter.m_pending.fetch_sub(1, std::memory_order_seq_cst) == 1) {
+                std::vector<Job*> continuations;
+                {
+                    const std::lock_guard lock { counter.m_mutex };
+                    continuations.swap(counter.m_continuations);
+                }
+                for (Job* continuation : continuations) {
+                    push(worker, continuation);
+                }
+            }
+            // The counter may be destroyed by a waiting thread right after this.
+            counter.m_finishing.fetch_sub(1, std::memory_order_seq_cst);
+        }
+
+        bool try_execute_one(Worker& worker) {
+            Job* job = find_job(worker);
+            if (!job) return false;
+            execute(worker, job);
+            return true;
+        }
+
+        void run_worker(Worker& worker, const std::size_t index) {
+            t_worker = &worker;
+            Profiler::set_thread_name("Worker " + std::to_string(index));
+
+            while (!stop_requested.load(std::memory_order_acquire)) {
+                if (try_execute_one(worker)) continue;
+
+                // Sleep until new work is pushed, checking once more after reading the signal to not miss any.
+                const std::uint32_t signal = work_signal.load(std::memory_order_acquire);
+                if (try_execute_one(worker)) continue;
+                if (stop_requested.load(std::memory_order_acquire)) break;
+                work_signal.wait(signal, std::memory_order_acquire);
+            }
+            t_worker = nullptr;
+        }
+    };
+
+    JobSystem::JobSystem(const JobSettings& job_settings)
+        : m_impl(std::make_unique<Impl>()) {
+        const std::size_t hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+        const std::size_t worker_count = job_settings.worker_count != 0
+            ? job_settings.worker_count
+            : hardware_threads - 1;
+
+        m_impl->workers.reserve(worker_count + 1);
+        for (std::size_t i = 0; i <= worker_count; ++i) {
+            auto& worker = m_impl->workers.emplace_back(std::make_unique<Worker>());
+            worker->random_state = static_cast<std::uint32_t>(i * 2654435761u + 1);
+        }
+
+        // The constructing thread is the main thread and takes part as worker 0.
+        t_worker = m_impl->workers[0].get();
+        for (std::size_t i = 1; i <= worker_count; ++i) {
+            Worker& worker = *m_impl->workers[i];
+            worker.thread = std::thread([this, &worker, i] { m_impl->run_worker(worker, i); });
+        }
+    }
+
+    JobSystem::~JobSystem() {
+        // Finish all outstanding work before stopping the workers.
+        while (m_impl->try_execute_one(*m_impl->workers[0])) {}
+
+        m_impl->stop_requested.store(true, std::memory_order_release);
+        m_impl->work_signal.fetch_add(1, std::memory_order_release);
+        m_impl->work_signal.notify_all();
+
+        for (auto& worker : m_impl->workers) {
+            if (worker->thread.joinable()) worker->thread.join();
+        }
+        t_worker = nullptr;
+    }
+
+    std::size_t JobSystem::get_thread_count() const noexcept {
+        return m_impl->workers.size();
+    }
+
+    void JobSystem::wait(JobCounter& counter) {
+        Worker& worker = m_impl->get_current_worker();
+        while (!counter.is_done()) {
+            if (!m_impl->try_execute_one(worker)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    Job* JobSystem::allocate_job() {
+        Worker& worker = m_impl->get_current_worker();
+        Job& job = worker.jobs[worker.next_job];
+        worker.next_job = (worker.next_job + 1) % JobsPerThread;
+
+        // Only happens with JobsPerThread jobs in flight; help finish them until the slot frees up.
+        while (job.m_in_use.load(std::memory_order_acquire)) {
+            if (!m_impl->try_execute_one(worker)) {
+                std::this_thread::yield();
+            }
+        }
+        job.m_in_use.store(true, std::memory_order_relaxed);
+        return &job;
+    }
+
+    void JobSystem::submit(Job* job) {
+        m_impl->push(m_impl->get_current_worker(), job);
+    }
+
+    void JobSystem::submit_after(JobCounter& dependency, Job* job) {
+        {
+            const std::lock_guard lock { dependency.m_mutex };
+            if (dependency.m_pending.load(std::memory_order_seq_cst) != 0) {
+                dependency.m_continuations.push_back(job);
+                return;
+            }
+        }
+        submit(job);
+    }
+} // vn
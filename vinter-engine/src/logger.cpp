@@ -1,17 +1,184 @@
 #include "vinter/logger.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
 namespace vn {
+    namespace {
+        constexpr std::size_t QueueCapacity { 1024 }; // Must be a power of two.
+        static_assert((QueueCapacity & (QueueCapacity - 1)) == 0);
+
+        struct alignas(64) Slot {
+            // Equals the slot's enqueue position once written, and that position + capacity once consumed.
+            std::atomic<std::uint64_t> sequence { 0 };
+            Logger::Level level { Logger::Level::Info };
+            std::uint16_t length { 0 };
+            char text[Logger::MaxAsyncMessageLength];
+        };
+
+        // Bounded multi-producer, single-consumer queue with per-slot sequence numbers.
+        struct AsyncState {
+            std::array<Slot, QueueCapacity> slots;
+
+            alignas(64) std::atomic<std::uint64_t> enqueue_position { 0 };
+            alignas(64) std::uint64_t dequeue_position { 0 };
+            std::uint64_t dropped_reported { 0 };
+
+            std::atomic<std::uint32_t> signal { 0 };
+            std::atomic<bool> stop_requested { false };
+
+            std::ofstream file;
+            std::thread worker;
+
+            AsyncState() {
+                for (std::size_t i = 0; i < QueueCapacity; ++i) {
+                    slots[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        std::atomic<AsyncState*> g_async_state { nullptr };
+        std::atomic<std::uint64_t> g_dropped_count { 0 };
+
+        void write_message(AsyncState& state, const Logger::Level level, const std::string_view level_name, const std::string_view message) {
+            std::ostream& out = state.file.is_open() ? state.file
+                              : (level == Logger::Level::Error) ? std::cerr : std::cout;
+
+            out << "[" << level_name << "] " << message << '\n';
+        }
+
+        bool try_enqueue(AsyncState& state, const Logger::Level level, const std::string_view message) {
+            std::uint64_t position = state.enqueue_position.load(std::memory_order_relaxed);
+            Slot* slot;
+
+            for (;;) {
+                slot = &state.slots[position & (QueueCapacity - 1)];
+                const std::uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<std::int64_t>(sequence - position);
+
+                if (difference == 0) {
+                    if (state.enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (difference < 0) {
+                    return false; // Full, the consumer has not released this slot yet.
+                } else {
+                    position = state.enqueue_position.load(std::memory_order_relaxed);
+                }
+            }
+
+            const std::size_t length = std::min(message.size(), Logger::MaxAsyncMessageLength);
+            std::memcpy(slot->text, message.data(), length);
+            if (length < message.size()) {
+                std::memcpy(slot->text + length - 3, "...", 3);
+            }
+            slot->level = level;
+            slot->length = static_cast<std::uint16_t>(length);
+            slot->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+    }
+
     void Logger::log(const Level level, std::string_view message) {
+        if (AsyncState* state = g_async_state.load(std::memory_order_acquire)) {
+            if (!try_enqueue(*state, level, message)) {
+                g_dropped_count.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            state->signal.fetch_add(1, std::memory_order_release);
+            state->signal.notify_one();
+            return;
+        }
+
         std::ostream& out = (level == Level::Error) ? std::cerr : std::cout;
 
         out << "[" << to_string(level) << "] " << message << std::endl;
     }
 
-    void Logger::debug(std::string_view msg)   { log(Level::Debug,   msg); }
     void Logger::info(std::string_view msg)    { log(Level::Info,    msg); }
     void Logger::warning(std::string_view msg) { log(Level::Warning, msg); }
     void Logger::error(std::string_view msg)   { log(Level::Error,   msg); }
 
+    void Logger::start_async(const std::string_view file_path) {
+        if (g_async_state.load()) return;
+
+        auto state = std::make_unique<AsyncState>();
+        if (!file_path.empty()) {
+            state->file.open(std::string { file_path });
+            if (!state->file) {
+                error("Failed to open log file, logging to the console instead.");
+            }
+        }
+
+        state->worker = std::thread([raw_state = state.get()] {
+            AsyncState& s = *raw_state;
+
+            for (;;) {
+                // Read the signal before draining, so a message enqueued after the drain wakes the wait.
+                const std::uint32_t signal = s.signal.load(std::memory_order_acquire);
+                const bool stopping = s.stop_requested.load(std::memory_order_acquire);
+
+                std::size_t drained = 0;
+                for (;;) {
+                    Slot& slot = s.slots[s.dequeue_position & (QueueCapacity - 1)];
+                    if (slot.sequence.load(std::memory_order_acquire) != s.dequeue_position + 1) break;
+
+                    write_message(s, slot.level, to_string(slot.level), { slot.text, slot.length });
+                    slot.sequence.store(s.dequeue_position + QueueCapacity, std::memory_order_release);
+                    ++s.dequeue_position;
+                    ++drained;
+                }
+
+                if (const std::uint64_t dropped = g_dropped_count.load(std::memory_order_relaxed);
+                    dropped != s.dropped_reported) {
+                    write_message(
+                        s, Level::Warning, to_string(Level::Warning),
+                        std::to_string(dropped - s.dropped_reported) + " log messages dropped (async buffer full)."
+                    );
+                    s.dropped_reported = dropped;
+                    ++drained;
+                }
+
+                if (drained > 0) {
+                    if (s.file.is_open()) s.file.flush();
+                    else { std::cout.flush(); std::cerr.flush(); }
+                }
+
+                if (stopping) break;
+                if (drained == 0) s.signal.wait(signal, std::memory_order_acquire);
+            }
+        });
+
+        g_async_state.store(state.release(), std::memory_order_release);
+    }
+
+    void Logger::stop_async() {
+        AsyncState* state = g_async_state.exchange(nullptr, std::memory_order_acq_rel);
+        if (!state) return;
+
+        state->stop_requested.store(true, std::memory_order_release);
+        state->signal.fetch_add(1, std::memory_order_release);
+        state->signal.notify_one();
+        state->worker.join();
+
+        delete state;
+    }
+
+    bool Logger::is_async() {
+        return g_async_state.load(std::memory_order_acquire) != nullptr;
+    }
+
+    std::uint64_t Logger::get_dropped_count() {
+        return g_dropped_count.load(std::memory_order_relaxed);
+    }
+
     std::string_view Logger::to_string(const Level level) {
         switch (level) {
             case Level::Debug:   return "DEBUG";
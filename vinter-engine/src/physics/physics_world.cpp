@@ -0,0 +1,288 @@
+#include "vinter/physics/physics_world.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "vinter/settings/physics_settings.hpp"
+#include "vinter/job_system.hpp"
+#include "vinter/logger.hpp"
+#include "vinter/profiler.hpp"
+#include "spatial_grid.hpp"
+
+namespace vn {
+    namespace {
+        // Slower impacts do not bounce, so that resting bodies settle instead of jittering.
+        constexpr float RestitutionThreshold { 20.f };
+
+        enum class Shape : std::uint8_t { Box, Circle };
+
+        struct Proxy {
+            entt::entity entity;
+            RigidBody* body;
+            glm::vec2 center;
+            glm::vec2 half_extents;     // The radius in both components for circles.
+            Shape shape;
+        };
+
+        struct Manifold {
+            glm::vec2 normal;
+            float penetration;
+        };
+
+        bool collide_circles(const Proxy& a, const Proxy& b, Manifold& manifold) noexcept {
+            const glm::vec2 offset = b.center - a.center;
+            const float radii = a.half_extents.x + b.half_extents.x;
+            const float distance_squared = glm::dot(offset, offset);
+            if (distance_squared >= radii * radii) return false;
+
+            const float distance = std::sqrt(distance_squared);
+            manifold.normal = distance > 0.f ? offset / distance : glm::vec2 { 0.f, 1.f };
+            manifold.penetration = radii - distance;
+            return true;
+        }
+
+        bool collide_boxes(const Proxy& a, const Proxy& b, Manifold& manifold) noexcept {
+            const glm::vec2 offset = b.center - a.center;
+            const glm::vec2 overlap = a.half_extents + b.half_extents - glm::abs(offset);
+            if (overlap.x <= 0.f || overlap.y <= 0.f) return false;
+
+            // Separate along the axis of least overlap.
+            if (overlap.x < overlap.y) {
+                manifold.normal = { offset.x < 0.f ? -1.f : 1.f, 0.f };
+                manifold.penetration = overlap.x;
+            } else {
+                manifold.normal = { 0.f, offset.y < 0.f ? -1.f : 1.f };
+                manifold.penetration = overlap.y;
+            }
+            return true;
+        }
+
+        bool collide_box_circle(const Proxy& box, const Proxy& circle, Manifold& manifold) noexcept {
+            const glm::vec2 offset = circle.center - box.center;
+            const glm::vec2 closest = glm::clamp(offset, -box.half_extents, box.half_extents);
+            const float radius = circle.half_extents.x;
+
+            if (closest != offset) {
+                const glm::vec2 to_center = offset - closest;
+                const float distance_squared = glm::dot(to_center, to_center);
+                if (distance_squared >= radius * radius) return false;
+
+                const float distance = std::sqrt(distance_squared);
+                manifold.normal = to_center / distance;
+                manifold.penetration = radius - distance;
+                return true;
+            }
+
+            // The center is inside the box, push it out through the nearest face.
+            const glm::vec2 depth = box.half_extents - glm::abs(offset);
+            if (depth.x < depth.y) {
+                manifold.normal = { offset.x < 0.f ? -1.f : 1.f, 0.f };
+                manifold.penetration = depth.x + radius;
+            } else {
+                manifold.normal = { 0.f, offset.y < 0.f ? -1.f : 1.f };
+                manifold.penetration = depth.y + radius;
+            }
+            return true;
+        }
+
+        bool collide(const Proxy& a, const Proxy& b, Manifold& manifold) noexcept {
+            if (a.shape == Shape::Box) {
+                return b.shape == Shape::Box ? collide_boxes(a, b, manifold) : collide_box_circle(a, b, manifold);
+            }
+            if (b.shape == Shape::Circle) return collide_circles(a, b, manifold);
+
+            if (!collide_box_circle(b, a, manifold)) return false;
+            manifold.normal = -manifold.normal;
+            return true;
+        }
+    }
+
+    struct PhysicsWorld::Impl {
+        struct SolverContact {
+            const Proxy* a;
+            const Proxy* b;
+            Manifold manifold;
+
+            float mass { 0.f };         // Effective mass along the normal and the tangent alike.
+            float bounce { 0.f };       // Target separating velocity.
+            float friction { 0.f };
+            float normal_impulse { 0.f };
+            float tangent_impulse { 0.f };
+        };
+
+        entt::registry& registry;
+        JobSystem& jobs;
+        PhysicsSettings settings;
+
+        std::vector<Proxy> proxies;
+        std::vector<Aabb> bounds;
+        SpatialGrid grid;
+
+        // One list per range of grid buckets tested in parallel, merged in order for a deterministic result.
+        std::vector<std::vector<SolverContact>> range_contacts;
+        std::vector<SolverContact> solver_contacts;
+        std::vector<Contact> contacts;
+
+        Impl(entt::registry& registry, JobSystem& jobs, const PhysicsSettings& physics_settings)
+            : registry(registry), jobs(jobs), settings(physics_settings) {
+            if (settings.cell_size <= 0.f) {
+                Logger::warning("PhysicsSettings::cell_size must be positive, using the default instead.");
+                settings.cell_size = PhysicsSettings {}.cell_size;
+            }
+        }
+
+        void add_proxy(const entt::entity entity, RigidBody& body, const Shape shape,
+                       const glm::vec2 offset, const glm::vec2 half_extents) {
+            const glm::vec2 center = body.position + offset;
+            proxies.push_back({ entity, &body, center, half_extents, shape });
+            bounds.push_back({ center - half_extents, center + half_extents });
+        }
+
+        void gather_proxies() {
+            proxies.clear();
+            bounds.clear();
+
+            for (auto [entity, body, box] : registry.view<RigidBody, BoxCollider>().each()) {
+                add_proxy(entity, body, Shape::Box, box.offset, box.half_extents);
+            }
+            for (auto [entity, body, circle] : registry.view<RigidBody, CircleCollider>().each()) {
+                add_proxy(entity, body, Shape::Circle, circle.offset, glm::vec2 { circle.radius });
+            }
+        }
+
+        void find_contacts() {
+            VN_PROFILE_ZONE("Narrowphase");
+            const std::size_t bucket_count = grid.get_bucket_count();
+            const std::size_t range_count = std::min(bucket_count, jobs.get_thread_count() * 4);
+            if (range_contacts.size() < range_count) range_contacts.resize(range_count);
+
+            jobs.parallel_for(range_count, 1, [&](const std::size_t range) {
+                std::vector<SolverContact>& found = range_contacts[range];
+                found.clear();
+
+                const std::size_t first = bucket_count * range / range_count;
+                const std::size_t last = bucket_count * (range + 1) / range_count;
+                grid.for_each_pair(first, last, [&](const std::uint32_t a_index, const std::uint32_t b_index) {
+                    const Proxy& a = proxies[a_index];
+                    const Proxy& b = proxies[b_index];
+                    if (a.body == b.body) return;
+                    if (a.body->inverse_mass == 0.f && b.body->inverse_mass == 0.f) return;
+
+                    Manifold manifold;
+                    if (collide(a, b, manifold)) {
+                        found.push_back({ .a = &a, .b = &b, .manifold = manifold });
+                    }
+                });
+            });
+
+            solver_contacts.clear();
+            for (std::size_t range = 0; range < range_count; ++range) {
+                solver_contacts.insert(solver_contacts.end(), range_contacts[range].begin(), range_contacts[range].end());
+            }
+        }
+
+        void solve_velocities() {
+            for (SolverContact& contact : solver_contacts) {
+                const RigidBody& a = *contact.a->body;
+                const RigidBody& b = *contact.b->body;
+
+                contact.mass = 1.f / (a.inverse_mass + b.inverse_mass);
+                contact.friction = std::sqrt(a.friction * b.friction);
+
+                const float approach = glm::dot(b.velocity - a.velocity, contact.manifold.normal);
+                contact.bounce = approach < -RestitutionThreshold
+                    ? -std::max(a.restitution, b.restitution) * approach
+                    : 0.f;
+            }
+
+            for (int iteration = 0; iteration < settings.iterations; ++iteration) {
+                for (SolverContact& contact : solver_contacts) {
+                    RigidBody& a = *contact.a->body;
+                    RigidBody& b = *contact.b->body;
+                    const glm::vec2 normal = contact.manifold.normal;
+                    const glm::vec2 tangent { -normal.y, normal.x };
+
+                    // Accumulated impulses are clamped rather than each pass's, so passes can correct each other.
+                    const float normal_speed = glm::dot(b.velocity - a.velocity, normal);
+                    const float normal_impulse = std::max(contact.normal_impulse + (contact.bounce - normal_speed) * contact.mass, 0.f);
+                    apply_impulse(a, b, normal * (normal_impulse - contact.normal_impulse));
+                    contact.normal_impulse = normal_impulse;
+
+                    const float max_friction = contact.friction * contact.normal_impulse;
+                    const float tangent_speed = glm::dot(b.velocity - a.velocity, tangent);
+                    const float tangent_impulse = std::clamp(contact.tangent_impulse - tangent_speed * contact.mass, -max_friction, max_friction);
+                    apply_impulse(a, b, tangent * (tangent_impulse - contact.tangent_impulse));
+                    contact.tangent_impulse = tangent_impulse;
+                }
+            }
+        }
+
+        static void apply_impulse(RigidBody& a, RigidBody& b, const glm::vec2 impulse) noexcept {
+            a.velocity -= impulse * a.inverse_mass;
+            b.velocity += impulse * b.inverse_mass;
+        }
+
+        void correct_positions() {
+            for (const SolverContact& contact : solver_contacts) {
+                RigidBody& a = *contact.a->body;
+                RigidBody& b = *contact.b->body;
+
+                const float depth = std::max(contact.manifold.penetration - settings.penetration_slop, 0.f);
+                const glm::vec2 correction = contact.manifold.normal * (depth * settings.position_correction * contact.mass);
+                a.position -= correction * a.inverse_mass;
+                b.position += correction * b.inverse_mass;
+            }
+        }
+
+        void step(const float delta) {
+            VN_PROFILE_ZONE("Physics");
+
+            const glm::vec2 gravity_step = settings.gravity * delta;
+            for (auto [entity, body] : registry.view<RigidBody>().each()) {
+                if (body.inverse_mass > 0.f) body.velocity += gravity_step * body.gravity_scale;
+            }
+
+            gather_proxies();
+            {
+                VN_PROFILE_ZONE("Broadphase");
+                grid.build(settings.cell_size, bounds);
+            }
+            find_contacts();
+            {
+                VN_PROFILE_ZONE("Solver");
+                solve_velocities();
+
+                for (auto [entity, body] : registry.view<RigidBody>().each()) {
+                    if (body.inverse_mass > 0.f) body.position += body.velocity * delta;
+                }
+                correct_positions();
+            }
+
+            contacts.clear();
+            for (const SolverContact& contact : solver_contacts) {
+                contacts.push_back({
+                    .a = contact.a->entity,
+                    .b = contact.b->entity,
+                    .normal = contact.manifold.normal,
+                    .penetration = contact.manifold.penetration,
+                });
+            }
+        }
+    };
+
+    PhysicsWorld::PhysicsWorld(entt::registry& registry, JobSystem& jobs, const PhysicsSettings& physics_settings)
+        : m_impl(std::make_unique<Impl>(registry, jobs, physics_settings)) {
+    }
+
+    PhysicsWorld::~PhysicsWorld() = default;
+
+    void PhysicsWorld::set_gravity(const glm::vec2 gravity) noexcept { m_impl->settings.gravity = gravity; }
+    glm::vec2 PhysicsWorld::get_gravity() const noexcept { return m_impl->settings.gravity; }
+
+    std::span<const Contact> PhysicsWorld::get_contacts() const noexcept { return m_impl->contacts; }
+
+    void PhysicsWorld::step(const float delta) {
+        m_impl->step(delta);
+    }
+} // vn
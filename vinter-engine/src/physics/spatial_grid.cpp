@@ -0,0 +1,42 @@
+#include "spatial_grid.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace vn {
+    void SpatialGrid::build(const float cell_size, const std::span<const Aabb> bounds) {
+        m_inverse_cell_size = 1.f / cell_size;
+        m_bounds = bounds;
+        m_unsorted.clear();
+
+        for (std::uint32_t index = 0; index < bounds.size(); ++index) {
+            const glm::ivec2 min = to_cell(bounds[index].min);
+            const glm::ivec2 max = to_cell(bounds[index].max);
+
+            for (int y = min.y; y <= max.y; ++y) {
+                for (int x = min.x; x <= max.x; ++x) {
+                    m_unsorted.push_back({ { x, y }, index });
+                }
+            }
+        }
+
+        // About one entry per bucket keeps both collisions and empty buckets rare.
+        const std::size_t bucket_count = std::bit_ceil(std::max<std::size_t>(m_unsorted.size(), 1));
+        const std::uint32_t mask = static_cast<std::uint32_t>(bucket_count - 1);
+
+        m_bucket_starts.assign(bucket_count + 1, 0);
+        for (const Entry& entry : m_unsorted) {
+            ++m_bucket_starts[(hash(entry.cell) & mask) + 1];
+        }
+        for (std::size_t bucket = 0; bucket < bucket_count; ++bucket) {
+            m_bucket_starts[bucket + 1] += m_bucket_starts[bucket];
+        }
+
+        // Scatter through a copy of the starts, advancing each bucket's cursor as it fills.
+        m_entries.resize(m_unsorted.size());
+        m_cursors.assign(m_bucket_starts.begin(), m_bucket_starts.end() - 1);
+        for (const Entry& entry : m_unsorted) {
+            m_entries[m_cursors[hash(entry.cell) & mask]++] = entry;
+        }
+    }
+} // vn
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace vn {
+    struct Aabb {
+        glm::vec2 min, max;
+
+        [[nodiscard]] bool overlaps(const Aabb& other) const noexcept {
+            return min.x < other.max.x && other.min.x < max.x &&
+                   min.y < other.max.y && other.min.y < max.y;
+        }
+    };
+
+    /**
+     * A uniform grid broadphase over a spatial hash, rebuilt from scratch every step.
+     *
+     * Every box is entered into each cell it overlaps, and the entries are counting sorted into hash
+     * buckets, so building is linear in the number of entries and needs no allocations once warmed up.
+     * Pairs are only reported from the cell holding the top-left corner of their overlap, so a pair
+     * sharing several cells is still reported once, without a set of visited pairs.
+     */
+    class SpatialGrid {
+    public:
+        void build(float cell_size, std::span<const Aabb> bounds);
+
+        [[nodiscard]] std::size_t get_bucket_count() const noexcept {
+            return m_bucket_starts.empty() ? 0 : m_bucket_starts.size() - 1;
+        }
+
+        /**
+         * Calls `function(a, b)` with the indices of every pair of overlapping boxes in the given buckets.
+         *
+         * @note Disjoint bucket ranges report disjoint pairs and may be walked concurrently.
+         */
+        template<typename F>
+        void for_each_pair(const std::size_t first_bucket, const std::size_t last_bucket, F&& function) const {
+            for (std::size_t bucket = first_bucket; bucket < last_bucket; ++bucket) {
+                const std::uint32_t begin = m_bucket_starts[bucket];
+                const std::uint32_t end = m_bucket_starts[bucket + 1];
+
+                for (std::uint32_t i = begin; i < end; ++i) {
+                    const Entry& first = m_entries[i];
+                    const Aabb& first_bounds = m_bounds[first.index];
+
+                    for (std::uint32_t j = i + 1; j < end; ++j) {
+                        const Entry& second = m_entries[j];
+                        // Distinct cells may share a bucket.
+                        if (second.cell != first.cell) continue;
+
+                        const Aabb& second_bounds = m_bounds[second.index];
+                        if (!first_bounds.overlaps(second_bounds)) continue;
+                        if (to_cell(glm::max(first_bounds.min, second_bounds.min)) != first.cell) continue;
+
+                        function(first.index, second.index);
+                    }
+                }
+            }
+        }
+
+    private:
+        struct Entry {
+            glm::ivec2 cell;
+            std::uint32_t index;
+        };
+
+        float m_inverse_cell_size { 1.f };
+        std::span<const Aabb> m_bounds;
+
+        std::vector<Entry> m_unsorted;
+        std::vector<Entry> m_entries;               // Grouped by bucket.
+        std::vector<std::uint32_t> m_bucket_starts; // One past the last bucket holds the entry count.
+        std::vector<std::uint32_t> m_cursors;
+
+        [[nodiscard]] glm::ivec2 to_cell(const glm::vec2 position) const noexcept {
+            return glm::ivec2 { glm::floor(position * m_inverse_cell_size) };
+        }
+
+        [[nodiscard]] static std::uint32_t hash(const glm::ivec2 cell) noexcept {
+            return static_cast<std::uint32_t>(cell.x) * 73856093u ^ static_cast<std::uint32_t>(cell.y) * 19349663u;
+        }
+    };
+} // vn
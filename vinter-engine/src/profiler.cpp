@@ -0,0 +1,170 @@
+#include "vinter/profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "vinter/logger.hpp"
+
+namespace vn {
+    namespace {
+        struct ThreadBuffer {
+            std::uint32_t thread_id { 0 };
+            std::string thread_name;
+
+            std::unique_ptr<Profiler::ZoneRecord[]> zones { new Profiler::ZoneRecord[Profiler::ZonesPerThread] };
+            // Total zones ever written; the write position is `head % ZonesPerThread`.
+            std::atomic<std::uint64_t> head { 0 };
+        };
+
+        struct Registry {
+            std::mutex mutex;
+            std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+        };
+
+        std::atomic<bool> g_enabled { false };
+
+        Registry& get_registry() {
+            static Registry registry;
+            return registry;
+        }
+
+        // Buffers are owned by the registry, so zones of finished threads survive until exported.
+        ThreadBuffer& get_thread_buffer() {
+            thread_local ThreadBuffer* buffer = [] {
+                Registry& registry = get_registry();
+                const std::lock_guard lock { registry.mutex };
+
+                auto& created = registry.buffers.emplace_back(std::make_unique<ThreadBuffer>());
+                created->thread_id = static_cast<std::uint32_t>(registry.buffers.size());
+                return created.get();
+            }();
+            return *buffer;
+        }
+
+        void write_json_string(std::ostream& out, const std::string_view str) {
+            out << '"';
+            for (const char c : str) {
+                if (c == '"' || c == '\\') out << '\\';
+                out << c;
+            }
+            out << '"';
+        }
+    }
+
+    Profiler::Zone::Zone(const char* name) noexcept
+        : m_name(name) {
+        if (g_enabled.load(std::memory_order_relaxed)) {
+            m_start_ns = now_ns();
+        }
+    }
+
+    Profiler::Zone::~Zone() {
+        // Zones started while disabled are never recorded, even if the profiler was enabled since.
+        if (m_start_ns == 0) return;
+
+        ThreadBuffer& buffer = get_thread_buffer();
+        const std::uint64_t head = buffer.head.load(std::memory_order_relaxed);
+
+        buffer.zones[head % ZonesPerThread] = { m_name, buffer.thread_id, m_start_ns, now_ns() };
+        buffer.head.store(head + 1, std::memory_order_release);
+    }
+
+    void Profiler::set_enabled(const bool enabled) noexcept {
+        g_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool Profiler::is_enabled() noexcept {
+        return g_enabled.load(std::memory_order_relaxed);
+    }
+
+    void Profiler::set_thread_name(const std::string_view name) {
+        ThreadBuffer& buffer = get_thread_buffer();
+
+        const std::lock_guard lock { get_registry().mutex };
+        buffer.thread_name = name;
+    }
+
+    std::uint64_t Profiler::now_ns() noexcept {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count());
+    }
+
+    std::vector<Profiler::ZoneRecord> Profiler::snapshot() {
+        std::vector<ZoneRecord> records;
+
+        Registry& registry = get_registry();
+        const std::lock_guard lock { registry.mutex };
+
+        for (const auto& buffer : registry.buffers) {
+            const std::uint64_t head = buffer->head.load(std::memory_order_acquire);
+            const std::uint64_t first = head > ZonesPerThread ? head - ZonesPerThread : 0;
+
+            for (std::uint64_t i = first; i < head; ++i) {
+                records.push_back(buffer->zones[i % ZonesPerThread]);
+            }
+        }
+
+        std::ranges::sort(records, {}, &ZoneRecord::start_ns);
+        return records;
+    }
+
+    bool Profiler::export_chrome_trace(const std::string_view path) {
+        std::ofstream out { std::string { path } };
+        if (!out) {
+            Logger::error("Failed to open profiler trace output file.");
+            return false;
+        }
+
+        const std::vector<ZoneRecord> records = snapshot();
+        const std::uint64_t origin_ns = records.empty() ? 0 : records.front().start_ns;
+
+        out << "{\"traceEvents\":[\n";
+        bool first = true;
+
+        // Thread name metadata events.
+        {
+            const std::lock_guard lock { get_registry().mutex };
+            for (const auto& buffer : get_registry().buffers) {
+                if (buffer->thread_name.empty()) continue;
+
+                out << (first ? "" : ",\n")
+                    << R"({"ph":"M","name":"thread_name","pid":1,"tid":)" << buffer->thread_id
+                    << R"(,"args":{"name":)";
+                write_json_string(out, buffer->thread_name);
+                out << "}}";
+                first = false;
+            }
+        }
+
+        // Complete events, timestamps in microseconds.
+        out.setf(std::ios::fixed);
+        out.precision(3);
+        for (const ZoneRecord& record : records) {
+            out << (first ? "" : ",\n") << R"({"ph":"X","name":)";
+            write_json_string(out, record.name);
+            out << R"(,"pid":1,"tid":)" << record.thread_id
+                << R"(,"ts":)" << static_cast<double>(record.start_ns - origin_ns) / 1000.0
+                << R"(,"dur":)" << static_cast<double>(record.end_ns - record.start_ns) / 1000.0
+                << "}";
+            first = false;
+        }
+        out << "\n]}\n";
+
+        return static_cast<bool>(out);
+    }
+
+    void Profiler::clear() {
+        Registry& registry = get_registry();
+        const std::lock_guard lock { registry.mutex };
+
+        for (const auto& buffer : registry.buffers) {
+            buffer->head.store(0, std::memory_order_release);
+        }
+    }
+} // vn
@@ -0,0 +1,313 @@
+#include "draw_queue.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "vinter/transform_batch.hpp"
+
+namespace vn {
+    std::uint64_t DrawQueue::to_sort_key(const std::int32_t layer, const TextureID texture) noexcept {
+        // Flip the sign bit so that negative layers sort before positive ones as unsigned integers.
+        const auto biased_layer = static_cast<std::uint32_t>(layer) ^ 0x80000000u;
+        return static_cast<std::uint64_t>(biased_layer) << 32 | texture;
+    }
+
+    void DrawQueue::push(const Sprite& sprite) {
+        m_order.push_back({
+            to_sort_key(sprite.layer, sprite.texture.id),
+            static_cast<std::uint32_t>(m_sprites.size()),
+            static_cast<std::uint32_t>(m_order.size())
+        });
+        m_sprites.push_back(sprite);
+    }
+
+    void DrawQueue::push_quads(const TextureID texture, const std::int32_t layer, const std::span<const Vertex> vertices) {
+        assert(vertices.size() % 4 == 0 && "Quads are made of four vertices.");
+        if (vertices.empty()) return;
+
+        m_order.push_back({
+            to_sort_key(layer, texture),
+            QuadRunFlag | static_cast<std::uint32_t>(m_quad_runs.size()),
+            static_cast<std::uint32_t>(m_order.size())
+        });
+        m_quad_runs.push_back({
+            texture,
+            static_cast<std::uint32_t>(m_quad_vertices.size()),
+            static_cast<std::uint32_t>(vertices.size() / 4)
+        });
+        m_quad_vertices.insert(m_quad_vertices.end(), vertices.begin(), vertices.end());
+    }
+
+    void DrawQueue::push_batch(const Sprite& sprite, const TransformBatch& transforms) {
+        if (transforms.is_empty()) return;
+
+        const auto [size, uv_min, uv_max, color] = resolve_sprite(sprite);
+
+        m_order.push_back({
+            to_sort_key(sprite.layer, sprite.texture.id),
+            TransformRunFlag | static_cast<std::uint32_t>(m_transform_runs.size()),
+            static_cast<std::uint32_t>(m_order.size())
+        });
+        m_transform_runs.push_back({
+            .texture = sprite.texture.id,
+            .quad = {
+                .offset = sprite.position,
+                .rotation = sprite.rotation,
+                .min = -sprite.origin,
+                .max = size - sprite.origin,
+                .uv_min = uv_min,
+                .uv_max = uv_max,
+                .color = color,
+            },
+            .size = size,
+            .origin = sprite.origin,
+            .offset = static_cast<std::uint32_t>(m_transforms_x.size()),
+            .count = static_cast<std::uint32_t>(transforms.get_count()),
+        });
+
+        const auto append = [](std::vector<float>& destination, const std::span<const float> source) {
+            destination.insert(destination.end(), source.begin(), source.end());
+        };
+        append(m_transforms_x, transforms.get_positions_x());
+        append(m_transforms_y, transforms.get_positions_y());
+        append(m_transform_rotations, transforms.get_rotations());
+        append(m_transform_scales_x, transforms.get_scales_x());
+        append(m_transform_scales_y, transforms.get_scales_y());
+    }
+
+    void DrawQueue::clear() {
+        m_sprites.clear();
+        m_quad_runs.clear();
+        m_quad_vertices.clear();
+        m_transform_runs.clear();
+        m_transforms_x.clear();
+        m_transforms_y.clear();
+        m_transform_rotations.clear();
+        m_transform_scales_x.clear();
+        m_transform_scales_y.clear();
+        m_order.clear();
+        m_vertices.clear();
+        m_indices.clear();
+        m_batches.clear();
+        m_instances.clear();
+        m_instance_batches.clear();
+    }
+
+    void DrawQueue::sort() {
+        // Ties are broken by submission sequence so that equal keys keep their submission order.
+        std::ranges::sort(m_order, [](const SortEntry& a, const SortEntry& b) {
+            return a.key != b.key ? a.key < b.key : a.sequence < b.sequence;
+        });
+    }
+
+    TextureID DrawQueue::get_texture(const std::uint32_t index) const noexcept {
+        if (index & QuadRunFlag) return m_quad_runs[index & ~RunFlags].texture;
+        if (index & TransformRunFlag) return m_transform_runs[index & ~RunFlags].texture;
+        return m_sprites[index].texture.id;
+    }
+
+    TransformArrays DrawQueue::get_transforms(const TransformRun& run) const noexcept {
+        return {
+            .positions_x = &m_transforms_x[run.offset],
+            .positions_y = &m_transforms_y[run.offset],
+            .rotations = &m_transform_rotations[run.offset],
+            .scales_x = &m_transform_scales_x[run.offset],
+            .scales_y = &m_transform_scales_y[run.offset],
+            .count = run.count,
+        };
+    }
+
+    void DrawQueue::build() {
+        m_vertices.clear();
+        m_indices.clear();
+        m_batches.clear();
+        if (is_empty()) return;
+
+        sort();
+
+        const std::size_t quad_count = get_quad_count();
+        m_vertices.resize(quad_count * 4);
+        m_indices.resize(quad_count * 6);
+
+        Batch* batch = nullptr;
+        std::uint32_t quad = 0;
+
+        const auto emit_indices = [&](const std::uint32_t count) {
+            std::uint32_t* indices = &m_indices[quad * 6];
+            for (std::uint32_t i = 0; i < count; ++i, indices += 6) {
+                const std::uint32_t base = batch->vertex_count + i * 4;
+                indices[0] = base + 0; indices[1] = base + 1; indices[2] = base + 2;
+                indices[3] = base + 2; indices[4] = base + 3; indices[5] = base + 0;
+            }
+            batch->vertex_count += count * 4;
+            batch->index_count += count * 6;
+            quad += count;
+        };
+
+        for (const auto& [key, index, sequence] : m_order) {
+            const TextureID texture = get_texture(index);
+
+            // Runs only break on texture changes, so consecutive layers sharing a texture merge.
+            if (!batch || batch->texture != texture) {
+                batch = &m_batches.emplace_back(Batch {
+                    .texture = texture,
+                    .vertex_offset = quad * 4,
+                    .index_offset = quad * 6,
+                });
+            }
+
+            if (index & QuadRunFlag) {
+                const QuadRun& run = m_quad_runs[index & ~RunFlags];
+                std::copy_n(&m_quad_vertices[run.vertex_offset], run.quad_count * 4, &m_vertices[quad * 4]);
+                emit_indices(run.quad_count);
+            } else if (index & TransformRunFlag) {
+                const TransformRun& run = m_transform_runs[index & ~RunFlags];
+                expand_quads(get_transforms(run), run.quad, &m_vertices[quad * 4]);
+                emit_indices(run.count);
+            } else {
+                expand_sprite(m_sprites[index], &m_vertices[quad * 4]);
+                emit_indices(1);
+            }
+        }
+    }
+
+    void DrawQueue::build_instances() {
+        m_instances.clear();
+        m_instance_batches.clear();
+        if (is_empty()) return;
+
+        sort();
+
+        m_instances.resize(get_quad_count());
+
+        InstanceBatch* batch = nullptr;
+        std::uint32_t instance = 0;
+        for (const auto& [key, index, sequence] : m_order) {
+            const TextureID texture = get_texture(index);
+
+            if (!batch || batch->texture != texture) {
+                batch = &m_instance_batches.emplace_back(InstanceBatch {
+                    .texture = texture,
+                    .instance_offset = instance,
+                });
+            }
+
+            if (index & QuadRunFlag) {
+                // Axis-aligned quads are fully described by their top-left and bottom-right corners.
+                const QuadRun& run = m_quad_runs[index & ~RunFlags];
+                const Vertex* vertices = &m_quad_vertices[run.vertex_offset];
+                for (std::uint32_t i = 0; i < run.quad_count; ++i, vertices += 4) {
+                    const glm::vec2 size = vertices[2].position - vertices[0].position;
+                    m_instances[instance++] = {
+                        .rect = { vertices[0].position.x, vertices[0].position.y, size.x, size.y },
+                        .pivot = { 0.f, 0.f, 0.f, 0.f },
+                        .uv_rect = { vertices[0].uv.x, vertices[0].uv.y, vertices[2].uv.x, vertices[2].uv.y },
+                        .color = vertices[0].color,
+                    };
+                }
+                batch->instance_count += run.quad_count;
+                continue;
+            }
+
+            if (index & TransformRunFlag) {
+                // The shaders transform instances themselves, so transforms map to instances one to one.
+                const TransformRun& run = m_transform_runs[index & ~RunFlags];
+                const TransformArrays transforms = get_transforms(run);
+                const glm::vec4 uv_rect { run.quad.uv_min.x, run.quad.uv_min.y, run.quad.uv_max.x, run.quad.uv_max.y };
+
+                for (std::size_t i = 0; i < transforms.count; ++i) {
+                    const glm::vec2 scale { transforms.scales_x[i], transforms.scales_y[i] };
+                    const glm::vec2 size = run.size * scale;
+                    const glm::vec2 origin = run.origin * scale;
+                    m_instances[instance++] = {
+                        .rect = {
+                            transforms.positions_x[i] + run.quad.offset.x, transforms.positions_y[i] + run.quad.offset.y,
+                            size.x, size.y
+                        },
+                        .pivot = { origin.x, origin.y, transforms.rotations[i] + run.quad.rotation, 0.f },
+                        .uv_rect = uv_rect,
+                        .color = run.quad.color,
+                    };
+                }
+                batch->instance_count += run.count;
+                continue;
+            }
+
+            const Sprite& sprite = m_sprites[index];
+            const auto [size, uv_min, uv_max, color] = resolve_sprite(sprite);
+            m_instances[instance++] = {
+                .rect = { sprite.position.x, sprite.position.y, size.x, size.y },
+                .pivot = { sprite.origin.x, sprite.origin.y, sprite.rotation, 0.f },
+                .uv_rect = { uv_min.x, uv_min.y, uv_max.x, uv_max.y },
+                .color = color,
+            };
+            ++batch->instance_count;
+        }
+    }
+
+    void DrawQueue::transform_vertices(const glm::vec2 scale, const glm::vec2 offset) noexcept {
+        if (scale == glm::vec2 { 1.f } && offset == glm::vec2 { 0.f }) return;
+
+        for (Vertex& vertex : m_vertices) {
+            vertex.position = vertex.position * scale + offset;
+        }
+    }
+
+    DrawQueue::ResolvedSprite DrawQueue::resolve_sprite(const Sprite& sprite) noexcept {
+        Rect source = sprite.source;
+        if (source.is_empty()) {
+            source = { 0.f, 0.f, static_cast<float>(sprite.texture.width), static_cast<float>(sprite.texture.height) };
+        }
+
+        ResolvedSprite resolved {
+            .size = (sprite.size.x != 0.f || sprite.size.y != 0.f) ? sprite.size : source.get_size(),
+            .uv_min = glm::vec2 { 0.f },
+            .uv_max = glm::vec2 { 0.f },
+            .color = {
+                sprite.tint.r / 255.f, sprite.tint.g / 255.f,
+                sprite.tint.b / 255.f, sprite.tint.a / 255.f
+            },
+        };
+
+        if (sprite.texture.width > 0 && sprite.texture.height > 0) {
+            const glm::vec2 texture_size { sprite.texture.width, sprite.texture.height };
+            resolved.uv_min = source.get_position() / texture_size;
+            resolved.uv_max = (source.get_position() + source.get_size()) / texture_size;
+        }
+        return resolved;
+    }
+
+    void DrawQueue::expand_sprite(const Sprite& sprite, Vertex* out) noexcept {
+        const auto [size, uv_min, uv_max, color] = resolve_sprite(sprite);
+
+        // Corners in clockwise order starting at the top-left, relative to the origin.
+        const glm::vec2 corners[4] {
+            { -sprite.origin.x,          -sprite.origin.y          },
+            {  size.x - sprite.origin.x, -sprite.origin.y          },
+            {  size.x - sprite.origin.x,  size.y - sprite.origin.y },
+            { -sprite.origin.x,           size.y - sprite.origin.y },
+        };
+
+        const glm::vec2 uvs[4] {
+            { uv_min.x, uv_min.y }, { uv_max.x, uv_min.y },
+            { uv_max.x, uv_max.y }, { uv_min.x, uv_max.y },
+        };
+
+        if (sprite.rotation == 0.f) {
+            for (int i = 0; i < 4; ++i) {
+                out[i] = { sprite.position + corners[i], color, uvs[i] };
+            }
+        } else {
+            const float c = std::cos(sprite.rotation);
+            const float s = std::sin(sprite.rotation);
+            for (int i = 0; i < 4; ++i) {
+                const glm::vec2 rotated {
+                    corners[i].x * c - corners[i].y * s,
+                    corners[i].x * s + corners[i].y * c
+                };
+                out[i] = { sprite.position + rotated, color, uvs[i] };
+            }
+        }
+    }
+} // vn
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "vinter/sprite.hpp"
+#include "vinter/vertex.hpp"
+#include "quad_kernels.hpp"
+
+namespace vn {
+    class TransformBatch;
+
+    /**
+     * Records the draw commands of a frame and turns them into texture-sorted vertex batches.
+     *
+     * Commands are only recorded while the frame is built; all vertex expansion happens in `build`,
+     * after sorting, so the backend receives one contiguous vertex range per batch.
+     */
+    class DrawQueue {
+    public:
+        struct Batch {
+            TextureID texture { 0 };
+            std::uint32_t vertex_offset { 0 };
+            std::uint32_t vertex_count { 0 };
+            std::uint32_t index_offset { 0 };
+            std::uint32_t index_count { 0 };
+        };
+
+        /**
+         * Per-instance sprite data for instanced quad rendering. Matches the instance vertex layout
+         * of the SDL_GPU sprite shaders.
+         */
+        struct Instance {
+            glm::vec4 rect;     // Position (xy), size (zw).
+            glm::vec4 pivot;    // Origin (xy), rotation (z).
+            glm::vec4 uv_rect;  // Top-left uv (xy), bottom-right uv (zw).
+            glm::vec4 color;
+        };
+
+        struct InstanceBatch {
+            TextureID texture { 0 };
+            std::uint32_t instance_offset { 0 };
+            std::uint32_t instance_count { 0 };
+        };
+
+        void push(const Sprite& sprite);
+
+        /**
+         * Records prebuilt, axis-aligned quads of four vertices each, in the corner order of expanded sprites
+         * (clockwise from the top-left). They are sorted as a single command and copied as-is into the batches.
+         */
+        void push_quads(TextureID texture, std::int32_t layer, std::span<const Vertex> vertices);
+
+        /**
+         * Records one instance of `sprite` per transform, moved by the transform's position, turned by its
+         * rotation and scaled around the sprite's origin by its scale. The transforms are copied as a whole,
+         * sorted as a single command, and expanded in one vectorized pass.
+         */
+        void push_batch(const Sprite& sprite, const TransformBatch& transforms);
+
+        /**
+         * Sorts the recorded commands by layer and texture and expands them into vertices and batches.
+         *
+         * @note Indices of each batch are relative to the batch's first vertex.
+         */
+        void build();
+
+        /**
+         * Sorts the recorded commands by layer and texture and expands them into one instance per sprite,
+         * grouped into instance batches.
+         */
+        void build_instances();
+
+        /**
+         * Scales and offsets the positions of the built vertices, for backends without a view transform.
+         */
+        void transform_vertices(glm::vec2 scale, glm::vec2 offset) noexcept;
+
+        void clear();
+
+        [[nodiscard]] bool is_empty() const noexcept {
+            return m_sprites.empty() && m_quad_runs.empty() && m_transform_runs.empty();
+        }
+        [[nodiscard]] std::size_t get_sprite_count() const noexcept { return m_sprites.size(); }
+        [[nodiscard]] std::size_t get_quad_count() const noexcept {
+            return m_sprites.size() + m_quad_vertices.size() / 4 + m_transforms_x.size();
+        }
+
+        [[nodiscard]] const std::vector<Vertex>& get_vertices() const noexcept { return m_vertices; }
+        [[nodiscard]] const std::vector<std::uint32_t>& get_indices() const noexcept { return m_indices; }
+        [[nodiscard]] const std::vector<Batch>& get_batches() const noexcept { return m_batches; }
+
+        [[nodiscard]] const std::vector<Instance>& get_instances() const noexcept { return m_instances; }
+        [[nodiscard]] const std::vector<InstanceBatch>& get_instance_batches() const noexcept {
+            return m_instance_batches;
+        }
+
+    private:
+        // Mark sort entries that index m_quad_runs or m_transform_runs instead of m_sprites.
+        static constexpr std::uint32_t QuadRunFlag { 0x80000000u };
+        static constexpr std::uint32_t TransformRunFlag { 0x40000000u };
+        static constexpr std::uint32_t RunFlags { QuadRunFlag | TransformRunFlag };
+
+        struct SortEntry {
+            std::uint64_t key;
+            std::uint32_t index;
+            std::uint32_t sequence; // Submission order across sprites and runs, breaks ties between equal keys.
+        };
+
+        struct QuadRun {
+            TextureID texture;
+            std::uint32_t vertex_offset;
+            std::uint32_t quad_count;
+        };
+
+        struct TransformRun {
+            TextureID texture;
+            QuadTemplate quad;
+            glm::vec2 size;
+            glm::vec2 origin;
+            std::uint32_t offset;   // Into the transform arrays.
+            std::uint32_t count;
+        };
+
+        struct ResolvedSprite {
+            glm::vec2 size;
+            glm::vec2 uv_min, uv_max;
+            glm::vec4 color;
+        };
+
+        [[nodiscard]] static std::uint64_t to_sort_key(std::int32_t layer, TextureID texture) noexcept;
+        [[nodiscard]] static ResolvedSprite resolve_sprite(const Sprite& sprite) noexcept;
+        static void expand_sprite(const Sprite& sprite, Vertex* out) noexcept;
+
+        void sort();
+
+        [[nodiscard]] TextureID get_texture(std::uint32_t index) const noexcept;
+        [[nodiscard]] TransformArrays get_transforms(const TransformRun& run) const noexcept;
+
+        std::vector<Sprite> m_sprites;
+        std::vector<QuadRun> m_quad_runs;
+        std::vector<Vertex> m_quad_vertices;
+        std::vector<TransformRun> m_transform_runs;
+        std::vector<float> m_transforms_x, m_transforms_y, m_transform_rotations, m_transform_scales_x, m_transform_scales_y;
+        std::vector<SortEntry> m_order;
+
+        std::vector<Vertex> m_vertices;
+        std::vector<std::uint32_t> m_indices;
+        std::vector<Batch> m_batches;
+
+        std::vector<Instance> m_instances;
+        std::vector<InstanceBatch> m_instance_batches;
+    };
+} // vn
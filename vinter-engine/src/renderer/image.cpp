@@ -0,0 +1,66 @@
+#include "image.hpp"
+
+#include <cstring>
+#include <string>
+
+#include <SDL3/SDL.h>
+
+#include "vinter/logger.hpp"
+
+namespace vn {
+    namespace {
+        /**
+         * Converts a decoded surface to tightly packed RGBA pixels, destroying it.
+         */
+        bool read_surface(SDL_Surface* surface, Image& image) {
+            if (!surface) {
+                Logger::error(SDL_GetError());
+                return false;
+            }
+
+            SDL_Surface* rgba_surface = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+            SDL_DestroySurface(surface);
+            if (!rgba_surface) {
+                Logger::error(SDL_GetError());
+                return false;
+            }
+
+            // Repack rows in case the surface pitch is padded.
+            image.width = rgba_surface->w;
+            image.height = rgba_surface->h;
+            image.pixels.resize(static_cast<std::size_t>(rgba_surface->w) * rgba_surface->h * 4);
+            SDL_ConvertPixels(
+                rgba_surface->w, rgba_surface->h,
+                SDL_PIXELFORMAT_RGBA32, rgba_surface->pixels, rgba_surface->pitch,
+                SDL_PIXELFORMAT_RGBA32, image.pixels.data(), rgba_surface->w * 4
+            );
+
+            SDL_DestroySurface(rgba_surface);
+            return true;
+        }
+    }
+
+    bool load_image(const std::string_view path, Image& image) {
+        const std::string path_string { path };
+
+        return read_surface(
+            path.ends_with(".bmp") ? SDL_LoadBMP(path_string.c_str()) : SDL_LoadPNG(path_string.c_str()),
+            image
+        );
+    }
+
+    bool load_image(const std::span<const std::byte> data, Image& image) {
+        // Without a file extension, the format is told by its signature.
+        constexpr char BmpSignature[] { 'B', 'M' };
+        const bool is_bmp = data.size() >= sizeof(BmpSignature)
+            && std::memcmp(data.data(), BmpSignature, sizeof(BmpSignature)) == 0;
+
+        SDL_IOStream* stream = SDL_IOFromConstMem(data.data(), data.size());
+        if (!stream) {
+            Logger::error(SDL_GetError());
+            return false;
+        }
+
+        return read_surface(is_bmp ? SDL_LoadBMP_IO(stream, true) : SDL_LoadPNG_IO(stream, true), image);
+    }
+} // vn
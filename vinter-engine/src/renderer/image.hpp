@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace vn {
+    /**
+     * Tightly packed 8-bit RGBA pixels decoded from an image file.
+     */
+    struct Image {
+        int width { 0 }, height { 0 };
+        std::vector<std::uint8_t> pixels;
+    };
+
+    /**
+     * Loads an image file (BMP or PNG).
+     *
+     * @return `true` if the image was loaded, `false` otherwise, with the error logged.
+     */
+    bool load_image(std::string_view path, Image& image);
+
+    /**
+     * Decodes an image file (BMP or PNG) already in memory.
+     *
+     * @return `true` if the image was loaded, `false` otherwise, with the error logged.
+     */
+    bool load_image(std::span<const std::byte> data, Image& image);
+} // vn
@@ -0,0 +1,167 @@
+#include "quad_kernels.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
+#include "quad_kernels_lanes.hpp"
+
+namespace vn {
+    // The vectorized kernels write vertices as plain floats.
+    static_assert(sizeof(Vertex) == 8 * sizeof(float));
+    static_assert(offsetof(Vertex, position) == 0);
+    static_assert(offsetof(Vertex, color) == 2 * sizeof(float));
+    static_assert(offsetof(Vertex, uv) == 6 * sizeof(float));
+
+    namespace {
+        using QuadKernel = void (*)(const TransformArrays&, const QuadTemplate&, float*) noexcept;
+
+#if defined(__x86_64__) || defined(_M_X64)
+        struct Sse2Lanes {
+            static constexpr std::size_t Width { 4 };
+            using Mask = __m128;
+
+            __m128 v;
+
+            static Sse2Lanes load(const float* source) noexcept { return { _mm_loadu_ps(source) }; }
+            void store(float* destination) const noexcept { _mm_storeu_ps(destination, v); }
+            static Sse2Lanes set1(const float value) noexcept { return { _mm_set1_ps(value) }; }
+
+            static Sse2Lanes fmadd(const Sse2Lanes a, const Sse2Lanes b, const Sse2Lanes c) noexcept {
+                return { _mm_add_ps(_mm_mul_ps(a.v, b.v), c.v) };
+            }
+            // SSE2 has no rounding instruction, but conversions round to nearest by default.
+            static Sse2Lanes round(const Sse2Lanes a) noexcept { return { _mm_cvtepi32_ps(_mm_cvtps_epi32(a.v)) }; }
+            static Sse2Lanes abs(const Sse2Lanes a) noexcept { return { _mm_andnot_ps(_mm_set1_ps(-0.f), a.v) }; }
+            static Mask greater(const Sse2Lanes a, const Sse2Lanes b) noexcept { return _mm_cmpgt_ps(a.v, b.v); }
+
+            static Sse2Lanes select(const Mask mask, const Sse2Lanes a, const Sse2Lanes b) noexcept {
+                return { _mm_or_ps(_mm_and_ps(mask, a.v), _mm_andnot_ps(mask, b.v)) };
+            }
+            static Sse2Lanes with_sign_of(const Sse2Lanes magnitude, const Sse2Lanes sign) noexcept {
+                const __m128 sign_bit = _mm_set1_ps(-0.f);
+                return { _mm_or_ps(_mm_and_ps(sign.v, sign_bit), _mm_andnot_ps(sign_bit, magnitude.v)) };
+            }
+
+            friend Sse2Lanes operator+(const Sse2Lanes a, const Sse2Lanes b) noexcept { return { _mm_add_ps(a.v, b.v) }; }
+            friend Sse2Lanes operator-(const Sse2Lanes a, const Sse2Lanes b) noexcept { return { _mm_sub_ps(a.v, b.v) }; }
+            friend Sse2Lanes operator*(const Sse2Lanes a, const Sse2Lanes b) noexcept { return { _mm_mul_ps(a.v, b.v) }; }
+        };
+
+        bool has_avx2() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7) return false;
+
+            __cpuid(info, 1);
+            const bool fma = (info[2] & (1 << 12)) != 0;
+            const bool os_saves_ymm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+
+            __cpuidex(info, 7, 0);
+            const bool avx2 = (info[1] & (1 << 5)) != 0;
+            return avx2 && fma && os_saves_ymm;
+#else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+        }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+        struct NeonLanes {
+            static constexpr std::size_t Width { 4 };
+            using Mask = uint32x4_t;
+
+            float32x4_t v;
+
+            static NeonLanes load(const float* source) noexcept { return { vld1q_f32(source) }; }
+            void store(float* destination) const noexcept { vst1q_f32(destination, v); }
+            static NeonLanes set1(const float value) noexcept { return { vdupq_n_f32(value) }; }
+
+            static NeonLanes fmadd(const NeonLanes a, const NeonLanes b, const NeonLanes c) noexcept {
+                return { vfmaq_f32(c.v, a.v, b.v) };
+            }
+            static NeonLanes round(const NeonLanes a) noexcept { return { vrndnq_f32(a.v) }; }
+            static NeonLanes abs(const NeonLanes a) noexcept { return { vabsq_f32(a.v) }; }
+            static Mask greater(const NeonLanes a, const NeonLanes b) noexcept { return vcgtq_f32(a.v, b.v); }
+
+            static NeonLanes select(const Mask mask, const NeonLanes a, const NeonLanes b) noexcept {
+                return { vbslq_f32(mask, a.v, b.v) };
+            }
+            static NeonLanes with_sign_of(const NeonLanes magnitude, const NeonLanes sign) noexcept {
+                return { vbslq_f32(vdupq_n_u32(0x80000000u), sign.v, magnitude.v) };
+            }
+
+            friend NeonLanes operator+(const NeonLanes a, const NeonLanes b) noexcept { return { vaddq_f32(a.v, b.v) }; }
+            friend NeonLanes operator-(const NeonLanes a, const NeonLanes b) noexcept { return { vsubq_f32(a.v, b.v) }; }
+            friend NeonLanes operator*(const NeonLanes a, const NeonLanes b) noexcept { return { vmulq_f32(a.v, b.v) }; }
+        };
+#endif
+
+        QuadKernel select_kernel() noexcept {
+#if defined(VINTER_SIMD_DISABLED)
+            return nullptr;
+#elif defined(__x86_64__) || defined(_M_X64)
+            return has_avx2() ? expand_quads_avx2 : expand_quads_sse2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+            return expand_quads_neon;
+#else
+            return nullptr;
+#endif
+        }
+    }
+
+#if defined(__x86_64__) || defined(_M_X64)
+    void expand_quads_sse2(const TransformArrays& transforms, const QuadTemplate& quad, float* out) noexcept {
+        lanes::expand_quads<Sse2Lanes>(transforms, quad, out);
+    }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    void expand_quads_neon(const TransformArrays& transforms, const QuadTemplate& quad, float* out) noexcept {
+        lanes::expand_quads<NeonLanes>(transforms, quad, out);
+    }
+#endif
+
+    void expand_quads(const TransformArrays& transforms, const QuadTemplate& quad, Vertex* out) noexcept {
+        static const QuadKernel kernel = select_kernel();
+
+        if (kernel) {
+            kernel(transforms, quad, reinterpret_cast<float*>(out));
+        } else {
+            expand_quads_scalar(transforms, quad, out);
+        }
+    }
+
+    void expand_quads_scalar(const TransformArrays& transforms, const QuadTemplate& quad, Vertex* out) noexcept {
+        const glm::vec2 uvs[4] {
+            { quad.uv_min.x, quad.uv_min.y }, { quad.uv_max.x, quad.uv_min.y },
+            { quad.uv_max.x, quad.uv_max.y }, { quad.uv_min.x, quad.uv_max.y },
+        };
+
+        for (std::size_t i = 0; i < transforms.count; ++i, out += 4) {
+            const glm::vec2 position = glm::vec2 { transforms.positions_x[i], transforms.positions_y[i] } + quad.offset;
+            const glm::vec2 scale { transforms.scales_x[i], transforms.scales_y[i] };
+            const float rotation = transforms.rotations[i] + quad.rotation;
+
+            const glm::vec2 min = quad.min * scale;
+            const glm::vec2 max = quad.max * scale;
+            const glm::vec2 corners[4] { { min.x, min.y }, { max.x, min.y }, { max.x, max.y }, { min.x, max.y } };
+
+            const float c = std::cos(rotation);
+            const float s = std::sin(rotation);
+            for (int corner = 0; corner < 4; ++corner) {
+                const glm::vec2 rotated {
+                    corners[corner].x * c - corners[corner].y * s,
+                    corners[corner].x * s + corners[corner].y * c
+                };
+                out[corner] = { position + rotated, quad.color, uvs[corner] };
+            }
+        }
+    }
+} // vn
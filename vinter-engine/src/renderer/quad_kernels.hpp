@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+
+#include <glm/glm.hpp>
+
+#include "vinter/vertex.hpp"
+
+namespace vn {
+    /**
+     * Borrowed component arrays of `count` transforms, see TransformBatch.
+     */
+    struct TransformArrays {
+        const float* positions_x;
+        const float* positions_y;
+        const float* rotations;
+        const float* scales_x;
+        const float* scales_y;
+        std::size_t count;
+    };
+
+    /**
+     * What every quad of a batch shares, in the frame of the transforms.
+     */
+    struct QuadTemplate {
+        glm::vec2 offset;           // Added to every position.
+        float rotation;             // Added to every rotation.
+        glm::vec2 min, max;         // Top-left and bottom-right corners relative to the position, before scaling.
+        glm::vec2 uv_min, uv_max;
+        glm::vec4 color;
+    };
+
+    /**
+     * Expands every transform into a quad of four vertices, clockwise from the top-left corner, matching
+     * the corners of expanded sprites. `out` must hold `4 * transforms.count` vertices.
+     *
+     * Dispatches to the widest kernel the CPU supports, once detected on first use.
+     */
+    void expand_quads(const TransformArrays& transforms, const QuadTemplate& quad, Vertex* out) noexcept;
+
+    /**
+     * The reference kernel, one transform at a time with the standard library's trigonometry.
+     */
+    void expand_quads_scalar(const TransformArrays& transforms, const QuadTemplate& quad, Vertex* out) noexcept;
+
+    // The vectorized kernels write each vertex as 8 floats, in the layout of Vertex.
+#if defined(__x86_64__) || defined(_M_X64)
+    void expand_quads_sse2(const TransformArrays& transforms, const QuadTemplate& quad, float* out) noexcept;
+    void expand_quads_avx2(const TransformArrays& transforms, const QuadTemplate& quad, float* out) noexcept;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    void expand_quads_neon(const TransformArrays& transforms, const QuadTemplate& quad, float* out) noexcept;
+#endif
+} // vn
@@ -0,0 +1,48 @@
+// Compiled with AVX2 and FMA enabled (see CMakeLists.txt), and only called once the CPU is known to support both.
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+
+#include "quad_kernels_lanes.hpp"
+
+namespace vn {
+    namespace {
+        struct Avx2Lanes {
+            static constexpr std::size_t Width { 8 };
+            using Mask = __m256;
+
+            __m256 v;
+
+            static Avx2Lanes load(const float* source) noexcept { return { _mm256_loadu_ps(source) }; }
+            void store(float* destination) const noexcept { _mm256_storeu_ps(destination, v); }
+            static Avx2Lanes set1(const float value) noexcept { return { _mm256_set1_ps(value) }; }
+
+            static Avx2Lanes fmadd(const Avx2Lanes a, const Avx2Lanes b, const Avx2Lanes c) noexcept {
+                return { _mm256_fmadd_ps(a.v, b.v, c.v) };
+            }
+            static Avx2Lanes round(const Avx2Lanes a) noexcept {
+                return { _mm256_round_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) };
+            }
+            static Avx2Lanes abs(const Avx2Lanes a) noexcept { return { _mm256_andnot_ps(_mm256_set1_ps(-0.f), a.v) }; }
+            static Mask greater(const Avx2Lanes a, const Avx2Lanes b) noexcept { return _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ); }
+
+            static Avx2Lanes select(const Mask mask, const Avx2Lanes a, const Avx2Lanes b) noexcept {
+                return { _mm256_blendv_ps(b.v, a.v, mask) };
+            }
+            static Avx2Lanes with_sign_of(const Avx2Lanes magnitude, const Avx2Lanes sign) noexcept {
+                const __m256 sign_bit = _mm256_set1_ps(-0.f);
+                return { _mm256_or_ps(_mm256_and_ps(sign.v, sign_bit), _mm256_andnot_ps(sign_bit, magnitude.v)) };
+            }
+
+            friend Avx2Lanes operator+(const Avx2Lanes a, const Avx2Lanes b) noexcept { return { _mm256_add_ps(a.v, b.v) }; }
+            friend Avx2Lanes operator-(const Avx2Lanes a, const Avx2Lanes b) noexcept { return { _mm256_sub_ps(a.v, b.v) }; }
+            friend Avx2Lanes operator*(const Avx2Lanes a, const Avx2Lanes b) noexcept { return { _mm256_mul_ps(a.v, b.v) }; }
+        };
+    }
+
+    void expand_quads_avx2(const TransformArrays& transforms, const QuadTemplate& quad, float* out) noexcept {
+        lanes::expand_quads<Avx2Lanes>(transforms, quad, out);
+    }
+} // vn
+
+#endif
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+
+#include "quad_kernels.hpp"
+
+// Included by the translation unit of each instruction set, with that instruction set enabled. Everything
+// here is a template over the lane type, and only reads plain fields and writes plain floats: an inline
+// function emitted out of line in one of those translation units (glm, the standard library) could be the
+// copy the linker keeps for the whole program, and run instructions the CPU may not support.
+
+namespace vn::lanes {
+    /**
+     * Sine and cosine of every lane, accurate to about 1e-7 for angles within a few turns.
+     *
+     * The angle is reduced to [-pi, pi], folded to [-pi/2, pi/2] where the Taylor series converge quickly,
+     * and both are evaluated with Horner's scheme in x^2.
+     */
+    template<typename L>
+    void sincos(const L angle, L& sine, L& cosine) noexcept {
+        constexpr float InverseTwoPi { 0.159154943091895f };
+        // Two parts of 2 pi, so that subtracting whole turns loses no precision.
+        constexpr float TwoPiHigh { 6.28125f };
+        constexpr float TwoPiLow { 0.00193530717958647f };
+        constexpr float Pi { 3.14159265358979f };
+        constexpr float HalfPi { 1.57079632679490f };
+
+        const L turns = L::round(angle * L::set1(InverseTwoPi));
+        L x = angle - turns * L::set1(TwoPiHigh);
+        x = x - turns * L::set1(TwoPiLow);
+
+        // sin(x) = sin(pi - x) and cos(x) = -cos(pi - x), pi taking the sign of x.
+        const auto fold = L::greater(L::abs(x), L::set1(HalfPi));
+        x = L::select(fold, L::with_sign_of(L::set1(Pi), x) - x, x);
+        const L cosine_sign = L::select(fold, L::set1(-1.f), L::set1(1.f));
+
+        const L x2 = x * x;
+
+        L s = L::set1(-1.f / 39916800.f);
+        s = L::fmadd(s, x2, L::set1(1.f / 362880.f));
+        s = L::fmadd(s, x2, L::set1(-1.f / 5040.f));
+        s = L::fmadd(s, x2, L::set1(1.f / 120.f));
+        s = L::fmadd(s, x2, L::set1(-1.f / 6.f));
+        s = L::fmadd(s, x2, L::set1(1.f));
+        sine = s * x;
+
+        L c = L::set1(1.f / 479001600.f);
+        c = L::fmadd(c, x2, L::set1(-1.f / 3628800.f));
+        c = L::fmadd(c, x2, L::set1(1.f / 40320.f));
+        c = L::fmadd(c, x2, L::set1(-1.f / 720.f));
+        c = L::fmadd(c, x2, L::set1(1.f / 24.f));
+        c = L::fmadd(c, x2, L::set1(-1.f / 2.f));
+        c = L::fmadd(c, x2, L::set1(1.f));
+        cosine = c * cosine_sign;
+    }
+
+    /**
+     * Expands L::Width transforms starting at `first` into their corner positions, corner-major.
+     */
+    template<typename L>
+    void expand_corners(const TransformArrays& transforms, const std::size_t first, const QuadTemplate& quad,
+                        float (&xs)[4][L::Width], float (&ys)[4][L::Width]) noexcept {
+        const L x = L::load(transforms.positions_x + first) + L::set1(quad.offset.x);
+        const L y = L::load(transforms.positions_y + first) + L::set1(quad.offset.y);
+        const L scale_x = L::load(transforms.scales_x + first);
+        const L scale_y = L::load(transforms.scales_y + first);
+
+        L sine, cosine;
+        sincos(L::load(transforms.rotations + first) + L::set1(quad.rotation), sine, cosine);
+
+        const L left = L::set1(quad.min.x) * scale_x;
+        const L right = L::set1(quad.max.x) * scale_x;
+        const L top = L::set1(quad.min.y) * scale_y;
+        const L bottom = L::set1(quad.max.y) * scale_y;
+
+        // Rotated corner offsets: (u cos - v sin, u sin + v cos).
+        const L left_cos = left * cosine, left_sin = left * sine;
+        const L right_cos = right * cosine, right_sin = right * sine;
+        const L top_cos = top * cosine, top_sin = top * sine;
+        const L bottom_cos = bottom * cosine, bottom_sin = bottom * sine;
+
+        (x + left_cos - top_sin).store(xs[0]);     (y + left_sin + top_cos).store(ys[0]);
+        (x + right_cos - top_sin).store(xs[1]);    (y + right_sin + top_cos).store(ys[1]);
+        (x + right_cos - bottom_sin).store(xs[2]); (y + right_sin + bottom_cos).store(ys[2]);
+        (x + left_cos - bottom_sin).store(xs[3]);  (y + left_sin + bottom_cos).store(ys[3]);
+    }
+
+    /**
+     * Expands all transforms L::Width at a time, the remainder through a zero-padded copy.
+     */
+    template<typename L>
+    void expand_quads(const TransformArrays& transforms, const QuadTemplate& quad, float* out) noexcept {
+        constexpr std::size_t Width = L::Width;
+
+        // Every vertex is written as 8 floats: position, color and uv, see the layout checks of Vertex.
+        const float corners[4][8] {
+            { 0.f, 0.f, quad.color.x, quad.color.y, quad.color.z, quad.color.w, quad.uv_min.x, quad.uv_min.y },
+            { 0.f, 0.f, quad.color.x, quad.color.y, quad.color.z, quad.color.w, quad.uv_max.x, quad.uv_min.y },
+            { 0.f, 0.f, quad.color.x, quad.color.y, quad.color.z, quad.color.w, quad.uv_max.x, quad.uv_max.y },
+            { 0.f, 0.f, quad.color.x, quad.color.y, quad.color.z, quad.color.w, quad.uv_min.x, quad.uv_max.y },
+        };
+
+        float xs[4][Width], ys[4][Width];
+        const auto emit = [&](const std::size_t count) {
+            for (std::size_t lane = 0; lane < count; ++lane) {
+                for (int corner = 0; corner < 4; ++corner, out += 8) {
+                    for (int i = 0; i < 8; ++i) out[i] = corners[corner][i];
+                    out[0] = xs[corner][lane];
+                    out[1] = ys[corner][lane];
+                }
+            }
+        };
+
+        std::size_t first = 0;
+        for (; first + Width <= transforms.count; first += Width) {
+            expand_corners<L>(transforms, first, quad, xs, ys);
+            emit(Width);
+        }
+
+        if (const std::size_t remainder = transforms.count - first; remainder > 0) {
+            float padded[5][Width] {};
+            const float* sources[5] {
+                transforms.positions_x, transforms.positions_y, transforms.rotations,
+                transforms.scales_x, transforms.scales_y
+            };
+            for (int component = 0; component < 5; ++component) {
+                for (std::size_t i = 0; i < remainder; ++i) padded[component][i] = sources[component][first + i];
+            }
+
+            const TransformArrays tail { padded[0], padded[1], padded[2], padded[3], padded[4], Width };
+            expand_corners<L>(tail, 0, quad, xs, ys);
+            emit(remainder);
+        }
+    }
+} // vn::lanes
@@ -0,0 +1,44 @@
+#include "render_thread.hpp"
+
+#include "vinter/profiler.hpp"
+
+namespace vn {
+    RenderThread::RenderThread(std::function<void()> submit)
+        : m_submit(std::move(submit)),
+          m_thread([this] { run(); }) {
+    }
+
+    RenderThread::~RenderThread() {
+        wait_idle();
+        m_state.store(Stopping, std::memory_order_release);
+        m_state.notify_all();
+        m_thread.join();
+    }
+
+    void RenderThread::wait_idle() {
+        while (m_state.load(std::memory_order_acquire) == Pending) {
+            m_state.wait(Pending, std::memory_order_acquire);
+        }
+    }
+
+    void RenderThread::kick() {
+        m_state.store(Pending, std::memory_order_release);
+        m_state.notify_all();
+    }
+
+    void RenderThread::run() {
+        Profiler::set_thread_name("Render");
+
+        for (;;) {
+            m_state.wait(Idle, std::memory_order_acquire);
+            if (m_state.load(std::memory_order_acquire) == Stopping) break;
+
+            {
+                VN_PROFILE_ZONE("Submit");
+                m_submit();
+            }
+            m_state.store(Idle, std::memory_order_release);
+            m_state.notify_all();
+        }
+    }
+} // vn
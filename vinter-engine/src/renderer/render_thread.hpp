@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+namespace vn {
+    /**
+     * A dedicated thread that submits recorded frames, one at a time, while the next one is recorded.
+     *
+     * The handoff is a single state word: the recording thread kicks a frame once the thread is idle, and
+     * waits for it to become idle again before kicking the next, so at most one frame is ever in flight.
+     */
+    class RenderThread {
+    public:
+        explicit RenderThread(std::function<void()> submit);
+        ~RenderThread();
+
+        RenderThread(const RenderThread&) = delete;
+        RenderThread& operator=(const RenderThread&) = delete;
+
+        /**
+         * Blocks until the frame in flight, if any, has been submitted.
+         */
+        void wait_idle();
+
+        /**
+         * Starts submitting the next frame.
+         *
+         * @note Must only be called after `wait_idle`, from the same thread.
+         */
+        void kick();
+
+    private:
+        enum State : std::uint32_t {
+            Idle,
+            Pending,
+            Stopping,
+        };
+
+        std::function<void()> m_submit;
+        std::atomic<std::uint32_t> m_state { Idle };
+        std::thread m_thread;
+
+        void run();
+    };
+} // vn
@@ -1,24 +1,196 @@
 #include "vinter/renderer.hpp"
 
+#include <utility>
+
 #include "vinter/settings/renderer_settings.hpp"
+#include "vinter/camera.hpp"
+#include "vinter/logger.hpp"
+#include "draw_queue.hpp"
+#include "image.hpp"
+#include "render_thread.hpp"
 #include "renderer_sdl.hpp"
 #include "renderer_sdlgpu.hpp"
+#include "renderer_null.hpp"
 
 namespace vn {
+    namespace {
+        /**
+         * Returns a conservative world space bounding box of a sprite, rotated sprites included.
+         */
+        Rect get_sprite_bounds(const Sprite& sprite) noexcept {
+            glm::vec2 size = sprite.size;
+            if (size.x == 0.f && size.y == 0.f) {
+                size = sprite.source.is_empty()
+                    ? glm::vec2 { sprite.texture.width, sprite.texture.height }
+                    : sprite.source.get_size();
+            }
+
+            const glm::vec2 min = glm::min(-sprite.origin, size - sprite.origin);
+            const glm::vec2 max = glm::max(-sprite.origin, size - sprite.origin);
+
+            if (sprite.rotation == 0.f) {
+                return { sprite.position.x + min.x, sprite.position.y + min.y, max.x - min.x, max.y - min.y };
+            }
+
+            // Any rotation about the origin stays within the circle through the farthest corner.
+            const float radius = glm::length(glm::max(-min, max));
+            return { sprite.position.x - radius, sprite.position.y - radius, 2.f * radius, 2.f * radius };
+        }
+    }
+
     std::unique_ptr<Renderer> Renderer::create(const RendererSettings &renderer_settings, const Window &window) {
+        std::unique_ptr<Renderer> renderer;
         switch (renderer_settings.backend) {
             case RendererSettings::Backend::SDL:
-                return std::make_unique<RendererSDL>(renderer_settings, window);
+                renderer = std::make_unique<RendererSDL>(renderer_settings, window);
+                break;
 
             case RendererSettings::Backend::SDL_GPU:
-                return std::make_unique<RendererSDLGPU>(renderer_settings, window);
+                renderer = std::make_unique<RendererSDLGPU>(renderer_settings, window);
+                break;
+
+            case RendererSettings::Backend::Null:
+                renderer = std::make_unique<RendererNull>();
+                break;
+        }
+
+        // SDL_Renderer only renders on the main thread, which owns its context.
+        if (renderer_settings.threaded && renderer_settings.backend == RendererSettings::Backend::SDL) {
+            Logger::warning("The SDL renderer backend cannot render on a render thread, rendering on the main thread.");
+        } else if (renderer && renderer_settings.threaded) {
+            renderer->m_record_index = 1;
+            renderer->m_render_thread = std::make_unique<RenderThread>([backend = renderer.get()] {
+                backend->begin_frame();
+                backend->end_frame();
+            });
         }
+        return renderer;
+    }
 
-        return nullptr;
+    Renderer::Renderer()
+        : m_draw_queues { std::make_unique<DrawQueue>(), std::make_unique<DrawQueue>() },
+          m_screen_draw_queues { std::make_unique<DrawQueue>(), std::make_unique<DrawQueue>() } {
     }
 
     Renderer::~Renderer() {}
 
-    Color Renderer::get_clear_color() const { return m_clear_color; }
+    Color Renderer::get_clear_color() const { return m_submit_clear_color; }
     void Renderer::set_clear_color(const Color color) { m_clear_color = color; }
+
+    const Renderer::View& Renderer::get_view() const { return m_submit_view; }
+
+    DrawQueue& Renderer::get_draw_queue() const { return *m_draw_queues[m_submit_index]; }
+
+    const Renderer::View& Renderer::get_screen_view() const { return m_submit_screen_view; }
+
+    DrawQueue& Renderer::get_screen_draw_queue() const { return *m_screen_draw_queues[m_submit_index]; }
+
+    bool Renderer::is_threaded() const noexcept { return m_render_thread != nullptr; }
+
+    Texture Renderer::create_texture(const int width, const int height, const void* rgba_pixels) {
+        if (m_render_thread && !supports_concurrent_uploads()) m_render_thread->wait_idle();
+        return create_backend_texture(width, height, rgba_pixels);
+    }
+
+    void Renderer::update_texture(
+        const Texture texture,
+        const int x, const int y,
+        const int width, const int height,
+        const void* rgba_pixels
+    ) {
+        // An update staged early could land in the frame in flight, which may still draw the region's previous pixels.
+        if (m_render_thread) m_render_thread->wait_idle();
+        update_backend_texture(texture, x, y, width, height, rgba_pixels);
+    }
+
+    void Renderer::destroy_texture(const Texture texture) {
+        if (m_render_thread) m_render_thread->wait_idle();
+        destroy_backend_texture(texture);
+    }
+
+    void Renderer::set_camera(const Camera& camera) {
+        const float scale = camera.get_pixel_scale();
+        const Rect& viewport = camera.get_viewport();
+
+        m_view = {
+            .scale = glm::vec2 { scale },
+            .offset = viewport.get_size() * 0.5f - camera.position * scale,
+            .viewport = viewport,
+        };
+        m_view_rect = camera.get_view_rect();
+
+        // Screen space keeps the letterboxing and virtual resolution, but neither the position nor the zoom.
+        m_screen_view = {
+            .scale = glm::vec2 { camera.get_viewport_scale() },
+            .offset = {},
+            .viewport = viewport,
+        };
+    }
+
+    void Renderer::begin_recording() {
+        if (m_render_thread) return; // The render thread begins the frame once it is handed off.
+
+        m_submit_clear_color = m_clear_color;
+        begin_frame();
+    }
+
+    void Renderer::submit_recording() {
+        if (!m_render_thread) {
+            m_submit_view = m_view;
+            m_submit_screen_view = m_screen_view;
+            end_frame();
+            return;
+        }
+
+        // Bounded latency: the previous frame must be submitted before the next one is handed off.
+        m_render_thread->wait_idle();
+        // Presented here, on the main thread, for backends that cannot present from the render thread.
+        present_frame();
+
+        m_submit_clear_color = m_clear_color;
+        m_submit_view = m_view;
+        m_submit_screen_view = m_screen_view;
+        std::swap(m_record_index, m_submit_index);
+        m_render_thread->kick();
+    }
+
+    void Renderer::stop_render_thread() {
+        m_render_thread.reset();
+    }
+
+    Texture Renderer::load_texture(const std::string_view path) {
+        Image image;
+        if (!load_image(path, image)) return {};
+
+        return create_texture(image.width, image.height, image.pixels.data());
+    }
+
+    Texture Renderer::load_texture(const std::span<const std::byte> data) {
+        Image image;
+        if (!load_image(data, image)) return {};
+
+        return create_texture(image.width, image.height, image.pixels.data());
+    }
+
+    void Renderer::draw_sprite(const Sprite& sprite) {
+        if (!m_view_rect.is_empty() && !get_sprite_bounds(sprite).overlaps(m_view_rect)) return;
+
+        m_draw_queues[m_record_index]->push(sprite);
+    }
+
+    void Renderer::draw_sprites(const Sprite& sprite, const TransformBatch& transforms) {
+        m_draw_queues[m_record_index]->push_batch(sprite, transforms);
+    }
+
+    void Renderer::draw_quads(const Texture texture, const std::int32_t layer, const std::span<const Vertex> vertices) {
+        m_draw_queues[m_record_index]->push_quads(texture.id, layer, vertices);
+    }
+
+    void Renderer::draw_screen_sprite(const Sprite& sprite) {
+        m_screen_draw_queues[m_record_index]->push(sprite);
+    }
+
+    void Renderer::draw_screen_quads(const Texture texture, const std::int32_t layer, const std::span<const Vertex> vertices) {
+        m_screen_draw_queues[m_record_index]->push_quads(texture.id, layer, vertices);
+    }
 }
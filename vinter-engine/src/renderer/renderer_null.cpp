@@ -0,0 +1,39 @@
+#include "renderer_null.hpp"
+
+#include "draw_queue.hpp"
+
+namespace vn {
+    Texture RendererNull::create_backend_texture(const int width, const int height, const void* rgba_pixels) {
+        TextureID id;
+        if (!m_free_texture_ids.empty()) {
+            id = m_free_texture_ids.back();
+            m_free_texture_ids.pop_back();
+        } else {
+            id = m_next_texture_id++;
+        }
+        return { id, width, height };
+    }
+
+    void RendererNull::update_backend_texture(
+        const Texture texture,
+        const int x, const int y,
+        const int width, const int height,
+        const void* rgba_pixels
+    ) {
+    }
+
+    void RendererNull::destroy_backend_texture(const Texture texture) {
+        if (!texture.is_valid()) return;
+        m_free_texture_ids.push_back(texture.id);
+    }
+
+    void RendererNull::begin_frame() {
+    }
+
+    void RendererNull::end_frame() {
+        for (DrawQueue* queue : { &get_draw_queue(), &get_screen_draw_queue() }) {
+            queue->build();
+            queue->clear();
+        }
+    }
+} // vn
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+
+#include "vinter/renderer.hpp"
+
+namespace vn {
+    /**
+     * A renderer that draws nothing, for headless runs.
+     *
+     * Sprites are still sorted and batched every frame, so the CPU-side cost of rendering stays measurable.
+     */
+    class RendererNull final : public Renderer {
+    public:
+        RendererNull() = default;
+        ~RendererNull() override = default;
+
+    private:
+        TextureID m_next_texture_id { 1 };
+        std::vector<TextureID> m_free_texture_ids;
+
+        [[nodiscard]] Texture create_backend_texture(int width, int height, const void* rgba_pixels) override;
+        void update_backend_texture(Texture texture, int x, int y, int width, int height, const void* rgba_pixels) override;
+        void destroy_backend_texture(Texture texture) override;
+
+        void begin_frame() override;
+        void end_frame() override;
+    };
+} // vn
@@ -1,15 +1,24 @@
 #include "renderer_sdl.hpp"
 
+#include <stdexcept>
+#include <vector>
+
 #include <SDL3/SDL.h>
 
 #include "vinter/settings/renderer_settings.hpp"
 #include "vinter/window.hpp"
 #include "vinter/color.hpp"
+#include "vinter/logger.hpp"
+#include "draw_queue.hpp"
 
 namespace vn {
     struct RendererSDL::Impl {
         SDL_Renderer* sdl_renderer_backend { nullptr };
 
+        // Indexed by texture id - 1, released slots are recycled through the free list.
+        std::vector<SDL_Texture*> textures;
+        std::vector<TextureID> free_texture_ids;
+
         Impl(const RendererSettings &renderer_settings, const Window &window)
             : sdl_renderer_backend(SDL_CreateRenderer(window.get_native_handle(), "")) {
             if (!sdl_renderer_backend) throw std::runtime_error(SDL_GetError());
@@ -18,9 +27,52 @@ namespace vn {
         }
 
         ~Impl() {
+            for (SDL_Texture* texture : textures) {
+                if (texture) SDL_DestroyTexture(texture);
+            }
             if (sdl_renderer_backend) SDL_DestroyRenderer(sdl_renderer_backend);
         }
 
+        [[nodiscard]] SDL_Texture* get_texture(const TextureID id) const noexcept {
+            if (id == 0 || id > textures.size()) return nullptr;
+            return textures[id - 1];
+        }
+
+        void draw(DrawQueue& queue, const View& view) {
+            queue.build();
+            queue.transform_vertices(view.scale, view.offset);
+
+            // Vertices are relative to the viewport, which also clips them to the letterboxed area.
+            if (view.viewport.is_empty()) {
+                SDL_SetRenderViewport(sdl_renderer_backend, nullptr);
+            } else {
+                const SDL_Rect viewport {
+                    static_cast<int>(view.viewport.x), static_cast<int>(view.viewport.y),
+                    static_cast<int>(view.viewport.width), static_cast<int>(view.viewport.height)
+                };
+                SDL_SetRenderViewport(sdl_renderer_backend, &viewport);
+            }
+
+            const Vertex* vertices = queue.get_vertices().data();
+            const std::uint32_t* indices = queue.get_indices().data();
+
+            // One geometry submission per batch instead of one per sprite.
+            for (const DrawQueue::Batch& batch : queue.get_batches()) {
+                const Vertex* first = vertices + batch.vertex_offset;
+
+                SDL_RenderGeometryRaw(
+                    sdl_renderer_backend,
+                    get_texture(batch.texture),
+                    &first->position.x, sizeof(Vertex),
+                    reinterpret_cast<const SDL_FColor*>(&first->color), sizeof(Vertex),
+                    &first->uv.x, sizeof(Vertex),
+                    static_cast<int>(batch.vertex_count),
+                    indices + batch.index_offset, static_cast<int>(batch.index_count), sizeof(std::uint32_t)
+                );
+            }
+            queue.clear();
+        }
+
         static int to_sdl_vsync_mode(const RendererSettings::VSyncMode vsync_mode) {
             switch (vsync_mode) {
                 case RendererSettings::VSyncMode::Disabled:
@@ -47,6 +99,57 @@ namespace vn {
 
     RendererSDL::~RendererSDL() = default;
 
+    Texture RendererSDL::create_backend_texture(const int width, const int height, const void* rgba_pixels) {
+        SDL_Texture* sdl_texture = SDL_CreateTexture(
+            m_impl->sdl_renderer_backend,
+            SDL_PIXELFORMAT_RGBA32,
+            SDL_TEXTUREACCESS_STATIC,
+            width, height
+        );
+        if (!sdl_texture) {
+            Logger::error(SDL_GetError());
+            return {};
+        }
+        SDL_SetTextureScaleMode(sdl_texture, SDL_SCALEMODE_NEAREST);
+        SDL_SetTextureBlendMode(sdl_texture, SDL_BLENDMODE_BLEND);
+        if (rgba_pixels) {
+            SDL_UpdateTexture(sdl_texture, nullptr, rgba_pixels, width * 4);
+        }
+
+        TextureID id;
+        if (!m_impl->free_texture_ids.empty()) {
+            id = m_impl->free_texture_ids.back();
+            m_impl->free_texture_ids.pop_back();
+            m_impl->textures[id - 1] = sdl_texture;
+        } else {
+            m_impl->textures.push_back(sdl_texture);
+            id = static_cast<TextureID>(m_impl->textures.size());
+        }
+        return { id, width, height };
+    }
+
+    void RendererSDL::update_backend_texture(
+        const Texture texture,
+        const int x, const int y,
+        const int width, const int height,
+        const void* rgba_pixels
+    ) {
+        SDL_Texture* sdl_texture = m_impl->get_texture(texture.id);
+        if (!sdl_texture) return;
+
+        const SDL_Rect region { x, y, width, height };
+        SDL_UpdateTexture(sdl_texture, &region, rgba_pixels, width * 4);
+    }
+
+    void RendererSDL::destroy_backend_texture(const Texture texture) {
+        SDL_Texture* sdl_texture = m_impl->get_texture(texture.id);
+        if (!sdl_texture) return;
+
+        SDL_DestroyTexture(sdl_texture);
+        m_impl->textures[texture.id - 1] = nullptr;
+        m_impl->free_texture_ids.push_back(texture.id);
+    }
+
     void RendererSDL::begin_frame() {
         const auto clear_color = get_clear_color();
 
@@ -58,6 +161,9 @@ namespace vn {
     }
 
     void RendererSDL::end_frame() {
+        m_impl->draw(get_draw_queue(), get_view());
+        m_impl->draw(get_screen_draw_queue(), get_screen_view());
+
         SDL_RenderPresent(m_impl->sdl_renderer_backend);
     }
-} // vn
\ No newline at end of file
+} // vn
@@ -1,22 +1,719 @@
 #include "renderer_sdlgpu.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
 #include <SDL3/SDL.h>
 
 #include "vinter/settings/renderer_settings.hpp"
+#include "vinter/window.hpp"
+#include "vinter/logger.hpp"
+#include "draw_queue.hpp"
+
+#include "shaders/sprite_msl.hpp"
+#if defined(VINTER_HAS_SPIRV_SHADERS)
+#include "shaders/sprite_vert_spv.hpp"
+#include "shaders/sprite_frag_spv.hpp"
+#endif
 
 namespace vn {
+    // Number of frames the CPU may record ahead of the GPU before waiting.
+    static constexpr std::size_t FramesInFlight { 3 };
+    static constexpr std::uint32_t InitialInstanceCapacity { 4096 };
+
     struct RendererSDLGPU::Impl {
-        SDL_GPUDevice* sdl_gpu_device;
+        // Per in-flight frame upload state. The fence guards reuse of the transfer buffer, which carries the
+        // frame's staged uploads followed by its instances.
+        struct FrameSlot {
+            SDL_GPUTransferBuffer* transfer_buffer { nullptr };
+            std::uint32_t transfer_capacity { 0 };
+            SDL_GPUFence* fence { nullptr };
+        };
+
+        SDL_GPUDevice* sdl_gpu_device { nullptr };
+        SDL_Window* sdl_window { nullptr };
+        bool window_claimed { false };
+
+        SDL_GPUGraphicsPipeline* sprite_pipeline { nullptr };
+        SDL_GPUSampler* sprite_sampler { nullptr };
+
+        // Persistent unit quad geometry shared by every sprite instance.
+        SDL_GPUBuffer* quad_vertex_buffer { nullptr };
+        SDL_GPUBuffer* quad_index_buffer { nullptr };
+
+        // Persistent instance buffer, only reallocated when a frame outgrows it.
+        SDL_GPUBuffer* instance_buffer { nullptr };
+        std::uint32_t instance_capacity { 0 };
+
+        std::array<FrameSlot, FramesInFlight> frames {};
+        std::size_t frame_index { 0 };
+
+        // A buffer or texture region to fill from `staging`, in the copy pass of the next submitted frame.
+        struct StagedUpload {
+            SDL_GPUBuffer* buffer { nullptr };
+            SDL_GPUTexture* texture { nullptr };
+            std::uint32_t x { 0 }, y { 0 }, width { 0 }, height { 0 };
+            std::uint32_t offset { 0 };     // In `staging`, and in the frame's transfer buffer.
+            std::uint32_t size { 0 };
+        };
+
+        // Guards the textures and the staged uploads, since textures are created on the main thread while the
+        // render thread submits the previous frame, see `supports_concurrent_uploads`.
+        mutable std::mutex texture_mutex;
+
+        // Uploads requested since the last submitted frame, copied into the frame's transfer buffer at once.
+        std::vector<std::byte> staging;
+        std::vector<StagedUpload> staged_uploads;
+
+        // Threaded only: the render thread draws into the frame target, which the main thread copies to the
+        // swapchain, since SDL only acquires and presents swapchain textures on the window's thread. Its size
+        // follows the last acquired swapchain texture.
+        SDL_GPUTextureFormat swapchain_format { SDL_GPU_TEXTUREFORMAT_INVALID };
+        SDL_GPUTexture* frame_target { nullptr };
+        std::uint32_t frame_target_width { 0 }, frame_target_height { 0 };
+        std::uint32_t swapchain_width { 0 }, swapchain_height { 0 };
+
+        // Bound for untextured sprites, so a single pipeline handles both cases.
+        SDL_GPUTexture* white_texture { nullptr };
+
+        // Indexed by texture id - 1, released slots are recycled through the free list.
+        std::vector<SDL_GPUTexture*> textures;
+        std::vector<TextureID> free_texture_ids;
+
+        Impl(const RendererSettings& renderer_settings, const Window& window)
+            : sdl_window(window.get_native_handle()) {
+            SDL_GPUShaderFormat shader_formats = SDL_GPU_SHADERFORMAT_MSL;
+#if defined(VINTER_HAS_SPIRV_SHADERS)
+            shader_formats |= SDL_GPU_SHADERFORMAT_SPIRV;
+#endif
+            sdl_gpu_device = SDL_CreateGPUDevice(shader_formats, false, nullptr);
+            if (!sdl_gpu_device) throw std::runtime_error(SDL_GetError());
+
+            // The destructor does not run when the constructor throws, so what was created so far is released here.
+            try {
+                create_resources(renderer_settings);
+            } catch (...) {
+                release();
+                throw;
+            }
+        }
+
+        ~Impl() {
+            release();
+        }
+
+        void create_resources(const RendererSettings& renderer_settings) {
+            if (!SDL_ClaimWindowForGPUDevice(sdl_gpu_device, sdl_window)) throw std::runtime_error(SDL_GetError());
+            window_claimed = true;
+
+            SDL_SetGPUSwapchainParameters(
+                sdl_gpu_device, sdl_window,
+                SDL_GPU_SWAPCHAINCOMPOSITION_SDR,
+                to_sdl_present_mode(renderer_settings.vsync_mode)
+            );
+
+            swapchain_format = SDL_GetGPUSwapchainTextureFormat(sdl_gpu_device, sdl_window);
+            int window_width = 0, window_height = 0;
+            SDL_GetWindowSizeInPixels(sdl_window, &window_width, &window_height);
+            swapchain_width = static_cast<std::uint32_t>(window_width);
+            swapchain_height = static_cast<std::uint32_t>(window_height);
+
+            create_sprite_pipeline();
+            create_quad_buffers();
+            reserve_instances(InitialInstanceCapacity);
+
+            SDL_GPUSamplerCreateInfo sampler_info {};
+            sampler_info.min_filter = SDL_GPU_FILTER_NEAREST;
+            sampler_info.mag_filter = SDL_GPU_FILTER_NEAREST;
+            sampler_info.mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST;
+            sampler_info.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+            sampler_info.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+            sampler_info.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+            sprite_sampler = SDL_CreateGPUSampler(sdl_gpu_device, &sampler_info);
+            if (!sprite_sampler) throw std::runtime_error(SDL_GetError());
+
+            constexpr std::uint32_t white_pixel { 0xFFFFFFFF };
+            white_texture = create_texture(1, 1);
+            if (!white_texture) throw std::runtime_error(SDL_GetError());
+            upload_texture(white_texture, 0, 0, 1, 1, &white_pixel);
+        }
+
+        /**
+         * Releases every resource created so far, whether the constructor completed or not.
+         */
+        void release() noexcept {
+            if (!sdl_gpu_device) return;
+            SDL_WaitForGPUIdle(sdl_gpu_device);
+
+            for (FrameSlot& frame : frames) {
+                if (frame.fence) SDL_ReleaseGPUFence(sdl_gpu_device, frame.fence);
+                if (frame.transfer_buffer) SDL_ReleaseGPUTransferBuffer(sdl_gpu_device, frame.transfer_buffer);
+            }
+            for (SDL_GPUTexture* texture : textures) {
+                if (texture) SDL_ReleaseGPUTexture(sdl_gpu_device, texture);
+            }
+            if (white_texture) SDL_ReleaseGPUTexture(sdl_gpu_device, white_texture);
+            if (frame_target) SDL_ReleaseGPUTexture(sdl_gpu_device, frame_target);
+            if (instance_buffer) SDL_ReleaseGPUBuffer(sdl_gpu_device, instance_buffer);
+            if (quad_index_buffer) SDL_ReleaseGPUBuffer(sdl_gpu_device, quad_index_buffer);
+            if (quad_vertex_buffer) SDL_ReleaseGPUBuffer(sdl_gpu_device, quad_vertex_buffer);
+            if (sprite_sampler) SDL_ReleaseGPUSampler(sdl_gpu_device, sprite_sampler);
+            if (sprite_pipeline) SDL_ReleaseGPUGraphicsPipeline(sdl_gpu_device, sprite_pipeline);
+
+            if (window_claimed) SDL_ReleaseWindowFromGPUDevice(sdl_gpu_device, sdl_window);
+            SDL_DestroyGPUDevice(sdl_gpu_device);
+            sdl_gpu_device = nullptr;
+        }
+
+        [[nodiscard]] SDL_GPUTexture* get_texture(const TextureID id) const {
+            std::lock_guard lock { texture_mutex };
+            if (id == 0 || id > textures.size()) return white_texture;
+            SDL_GPUTexture* texture = textures[id - 1];
+            return texture ? texture : white_texture;
+        }
+
+        [[nodiscard]] SDL_GPUShader* create_shader(const SDL_GPUShaderStage stage) const {
+            const bool is_vertex = stage == SDL_GPU_SHADERSTAGE_VERTEX;
+
+            SDL_GPUShaderCreateInfo shader_info {};
+            shader_info.stage = stage;
+            shader_info.num_samplers = is_vertex ? 0 : 1;
+            shader_info.num_uniform_buffers = is_vertex ? 1 : 0;
+
+            const SDL_GPUShaderFormat supported_formats = SDL_GetGPUShaderFormats(sdl_gpu_device);
+#if defined(VINTER_HAS_SPIRV_SHADERS)
+            if (supported_formats & SDL_GPU_SHADERFORMAT_SPIRV) {
+                shader_info.format = SDL_GPU_SHADERFORMAT_SPIRV;
+                shader_info.code = is_vertex ? sprite_vert_spv : sprite_frag_spv;
+                shader_info.code_size = is_vertex ? sizeof(sprite_vert_spv) : sizeof(sprite_frag_spv);
+                shader_info.entrypoint = "main";
+            } else
+#endif
+            if (supported_formats & SDL_GPU_SHADERFORMAT_MSL) {
+                shader_info.format = SDL_GPU_SHADERFORMAT_MSL;
+                shader_info.code = sprite_msl;
+                shader_info.code_size = sizeof(sprite_msl);
+                shader_info.entrypoint = is_vertex ? "sprite_vertex" : "sprite_fragment";
+            } else {
+                throw std::runtime_error("SDL_GPU device supports none of the embedded shader formats.");
+            }
+
+            SDL_GPUShader* shader = SDL_CreateGPUShader(sdl_gpu_device, &shader_info);
+            if (!shader) throw std::runtime_error(SDL_GetError());
+            return shader;
+        }
+
+        void create_sprite_pipeline() {
+            SDL_GPUShader* vertex_shader = create_shader(SDL_GPU_SHADERSTAGE_VERTEX);
+            SDL_GPUShader* fragment_shader;
+            try {
+                fragment_shader = create_shader(SDL_GPU_SHADERSTAGE_FRAGMENT);
+            } catch (...) {
+                SDL_ReleaseGPUShader(sdl_gpu_device, vertex_shader);
+                throw;
+            }
+
+            const std::array<SDL_GPUVertexBufferDescription, 2> buffer_descriptions {{
+                { .slot = 0, .pitch = sizeof(glm::vec2), .input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX, .instance_step_rate = 0 },
+                { .slot = 1, .pitch = sizeof(DrawQueue::Instance), .input_rate = SDL_GPU_VERTEXINPUTRATE_INSTANCE, .instance_step_rate = 0 },
+            }};
+            const std::array<SDL_GPUVertexAttribute, 5> attributes {{
+                { .location = 0, .buffer_slot = 0, .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2, .offset = 0 },
+                { .location = 1, .buffer_slot = 1, .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4, .offset = 0 * sizeof(glm::vec4) },
+                { .location = 2, .buffer_slot = 1, .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4, .offset = 1 * sizeof(glm::vec4) },
+                { .location = 3, .buffer_slot = 1, .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4, .offset = 2 * sizeof(glm::vec4) },
+                { .location = 4, .buffer_slot = 1, .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4, .offset = 3 * sizeof(glm::vec4) },
+            }};
+
+            SDL_GPUColorTargetDescription color_target {};
+            color_target.format = swapchain_format;
+            color_target.blend_state.enable_blend = true;
+            color_target.blend_state.src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA;
+            color_target.blend_state.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+            color_target.blend_state.color_blend_op = SDL_GPU_BLENDOP_ADD;
+            color_target.blend_state.src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE;
+            color_target.blend_state.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+            color_target.blend_state.alpha_blend_op = SDL_GPU_BLENDOP_ADD;
+
+            SDL_GPUGraphicsPipelineCreateInfo pipeline_info {};
+            pipeline_info.vertex_shader = vertex_shader;
+            pipeline_info.fragment_shader = fragment_shader;
+            pipeline_info.vertex_input_state.vertex_buffer_descriptions = buffer_descriptions.data();
+            pipeline_info.vertex_input_state.num_vertex_buffers = buffer_descriptions.size();
+            pipeline_info.vertex_input_state.vertex_attributes = attributes.data();
+            pipeline_info.vertex_input_state.num_vertex_attributes = attributes.size();
+            pipeline_info.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+            pipeline_info.rasterizer_state.fill_mode = SDL_GPU_FILLMODE_FILL;
+            pipeline_info.rasterizer_state.cull_mode = SDL_GPU_CULLMODE_NONE;
+            pipeline_info.target_info.color_target_descriptions = &color_target;
+            pipeline_info.target_info.num_color_targets = 1;
+
+            sprite_pipeline = SDL_CreateGPUGraphicsPipeline(sdl_gpu_device, &pipeline_info);
+
+            // Shaders are no longer needed once baked into the pipeline.
+            SDL_ReleaseGPUShader(sdl_gpu_device, vertex_shader);
+            SDL_ReleaseGPUShader(sdl_gpu_device, fragment_shader);
+
+            if (!sprite_pipeline) throw std::runtime_error(SDL_GetError());
+        }
+
+        void create_quad_buffers() {
+            constexpr std::array<glm::vec2, 4> corners {{ { 0.f, 0.f }, { 1.f, 0.f }, { 1.f, 1.f }, { 0.f, 1.f } }};
+            constexpr std::array<std::uint16_t, 6> indices { 0, 1, 2, 2, 3, 0 };
+
+            quad_vertex_buffer = create_buffer(SDL_GPU_BUFFERUSAGE_VERTEX, sizeof(corners));
+            quad_index_buffer = create_buffer(SDL_GPU_BUFFERUSAGE_INDEX, sizeof(indices));
+
+            upload_buffer(quad_vertex_buffer, corners.data(), sizeof(corners));
+            upload_buffer(quad_index_buffer, indices.data(), sizeof(indices));
+        }
+
+        [[nodiscard]] SDL_GPUBuffer* create_buffer(const SDL_GPUBufferUsageFlags usage, const std::uint32_t size) const {
+            SDL_GPUBufferCreateInfo buffer_info {};
+            buffer_info.usage = usage;
+            buffer_info.size = size;
+
+            SDL_GPUBuffer* buffer = SDL_CreateGPUBuffer(sdl_gpu_device, &buffer_info);
+            if (!buffer) throw std::runtime_error(SDL_GetError());
+            return buffer;
+        }
+
+        [[nodiscard]] SDL_GPUTransferBuffer* create_transfer_buffer(const std::uint32_t size) const {
+            SDL_GPUTransferBufferCreateInfo transfer_info {};
+            transfer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+            transfer_info.size = size;
+
+            SDL_GPUTransferBuffer* transfer_buffer = SDL_CreateGPUTransferBuffer(sdl_gpu_device, &transfer_info);
+            if (!transfer_buffer) throw std::runtime_error(SDL_GetError());
+            return transfer_buffer;
+        }
+
+        [[nodiscard]] SDL_GPUTexture* create_texture(const std::uint32_t width, const std::uint32_t height) const {
+            SDL_GPUTextureCreateInfo texture_info {};
+            texture_info.type = SDL_GPU_TEXTURETYPE_2D;
+            texture_info.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+            texture_info.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER;
+            texture_info.width = width;
+            texture_info.height = height;
+            texture_info.layer_count_or_depth = 1;
+            texture_info.num_levels = 1;
+            texture_info.sample_count = SDL_GPU_SAMPLECOUNT_1;
+
+            return SDL_CreateGPUTexture(sdl_gpu_device, &texture_info);
+        }
+
+        // Every staged upload, and the instances after them, start aligned within the transfer buffer.
+        [[nodiscard]] static constexpr std::size_t align_staging(const std::size_t offset) noexcept {
+            constexpr std::size_t StagingAlignment { 16 };
+            return (offset + StagingAlignment - 1) & ~(StagingAlignment - 1);
+        }
+
+        /**
+         * Copies data to upload with the next frame, returning its offset in the frame's transfer buffer.
+         */
+        std::uint32_t stage(const void* data, const std::uint32_t size) {
+            const std::size_t offset = align_staging(staging.size());
+
+            staging.resize(offset + size);
+            std::memcpy(staging.data() + offset, data, size);
+            return static_cast<std::uint32_t>(offset);
+        }
+
+        // Static geometry and texture data are staged, then recorded in the next frame's copy pass ahead of its draws.
+        void upload_buffer(SDL_GPUBuffer* buffer, const void* data, const std::uint32_t size) {
+            staged_uploads.push_back({ .buffer = buffer, .offset = stage(data, size), .size = size });
+        }
+
+        void upload_texture(
+            SDL_GPUTexture* texture,
+            const std::uint32_t x, const std::uint32_t y,
+            const std::uint32_t width, const std::uint32_t height,
+            const void* rgba_pixels
+        ) {
+            const std::uint32_t size = width * height * 4;
+            staged_uploads.push_back({
+                .texture = texture,
+                .x = x, .y = y, .width = width, .height = height,
+                .offset = stage(rgba_pixels, size), .size = size
+            });
+        }
+
+        /**
+         * Records the staged uploads, already copied to the frame's transfer buffer, into its copy pass.
+         */
+        void record_staged_uploads(SDL_GPUCopyPass* copy_pass, SDL_GPUTransferBuffer* transfer_buffer) {
+            for (const StagedUpload& upload : staged_uploads) {
+                if (upload.buffer) {
+                    const SDL_GPUTransferBufferLocation source { .transfer_buffer = transfer_buffer, .offset = upload.offset };
+                    const SDL_GPUBufferRegion destination { .buffer = upload.buffer, .offset = 0, .size = upload.size };
+                    SDL_UploadToGPUBuffer(copy_pass, &source, &destination, false);
+                    continue;
+                }
+
+                SDL_GPUTextureTransferInfo source {};
+                source.transfer_buffer = transfer_buffer;
+                source.offset = upload.offset;
+                source.pixels_per_row = upload.width;
+                source.rows_per_layer = upload.height;
+
+                SDL_GPUTextureRegion destination {};
+                destination.texture = upload.texture;
+                destination.x = upload.x;
+                destination.y = upload.y;
+                destination.w = upload.width;
+                destination.h = upload.height;
+                destination.d = 1;
+
+                SDL_UploadToGPUTexture(copy_pass, &source, &destination, false);
+            }
+
+            staging.clear();
+            staged_uploads.clear();
+        }
+
+        void reserve_instances(const std::uint32_t count) {
+            if (count <= instance_capacity) return;
+
+            std::uint32_t capacity = std::max(instance_capacity, InitialInstanceCapacity);
+            while (capacity < count) capacity *= 2;
+
+            // The old buffer may still be read by in-flight frames; SDL defers its destruction.
+            if (instance_buffer) SDL_ReleaseGPUBuffer(sdl_gpu_device, instance_buffer);
+            instance_buffer = create_buffer(SDL_GPU_BUFFERUSAGE_VERTEX, capacity * sizeof(DrawQueue::Instance));
+            instance_capacity = capacity;
+        }
+
+        /**
+         * Returns the frame target, recreated at the size of the swapchain, or nullptr on failure.
+         */
+        SDL_GPUTexture* get_frame_target() {
+            const std::uint32_t width = std::max<std::uint32_t>(swapchain_width, 1);
+            const std::uint32_t height = std::max<std::uint32_t>(swapchain_height, 1);
+            if (frame_target && frame_target_width == width && frame_target_height == height) return frame_target;
+
+            // Frames in flight may still read the old target, SDL defers its destruction.
+            if (frame_target) SDL_ReleaseGPUTexture(sdl_gpu_device, frame_target);
+
+            SDL_GPUTextureCreateInfo texture_info {};
+            texture_info.type = SDL_GPU_TEXTURETYPE_2D;
+            texture_info.format = swapchain_format;
+            texture_info.usage = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET | SDL_GPU_TEXTUREUSAGE_SAMPLER;
+            texture_info.width = width;
+            texture_info.height = height;
+            texture_info.layer_count_or_depth = 1;
+            texture_info.num_levels = 1;
+            texture_info.sample_count = SDL_GPU_SAMPLECOUNT_1;
+
+            frame_target = SDL_CreateGPUTexture(sdl_gpu_device, &texture_info);
+            if (!frame_target) {
+                Logger::error(SDL_GetError());
+                return nullptr;
+            }
+            frame_target_width = width;
+            frame_target_height = height;
+            return frame_target;
+        }
+
+        void reserve_transfer(FrameSlot& frame, const std::uint32_t size) const {
+            if (size <= frame.transfer_capacity) return;
+
+            if (frame.transfer_buffer) SDL_ReleaseGPUTransferBuffer(sdl_gpu_device, frame.transfer_buffer);
+            frame.transfer_buffer = create_transfer_buffer(size);
+            frame.transfer_capacity = size;
+        }
+
+        static SDL_GPUPresentMode to_sdl_present_mode(const RendererSettings::VSyncMode vsync_mode) {
+            switch (vsync_mode) {
+                case RendererSettings::VSyncMode::Disabled:
+                    return SDL_GPU_PRESENTMODE_IMMEDIATE;
+
+                case RendererSettings::VSyncMode::Enabled:
+                    return SDL_GPU_PRESENTMODE_VSYNC;
+
+                case RendererSettings::VSyncMode::Adaptive:
+                    return SDL_GPU_PRESENTMODE_MAILBOX;
+            }
+
+            return SDL_GPU_PRESENTMODE_VSYNC;
+        }
     };
 
-    RendererSDLGPU::RendererSDLGPU(const RendererSettings &renderer_settings, const Window &window) {
+    RendererSDLGPU::RendererSDLGPU(const RendererSettings &renderer_settings, const Window &window)
+        : m_impl(std::make_unique<Impl>(renderer_settings, window)) {
+
+        // Show the window (briefly hidden on startup) AFTER Renderer has been constructed, so that
+        // the window does not show blank state due to non-existent renderer.
+        SDL_ShowWindow(window.get_native_handle());
     }
 
     RendererSDLGPU::~RendererSDLGPU() = default;
 
+    Texture RendererSDLGPU::create_backend_texture(const int width, const int height, const void* rgba_pixels) {
+        SDL_GPUTexture* gpu_texture = m_impl->create_texture(width, height);
+        if (!gpu_texture) {
+            Logger::error(SDL_GetError());
+            return {};
+        }
+        std::lock_guard lock { m_impl->texture_mutex };
+        if (rgba_pixels) {
+            m_impl->upload_texture(gpu_texture, 0, 0, width, height, rgba_pixels);
+        }
+
+        TextureID id;
+        if (!m_impl->free_texture_ids.empty()) {
+            id = m_impl->free_texture_ids.back();
+            m_impl->free_texture_ids.pop_back();
+            m_impl->textures[id - 1] = gpu_texture;
+        } else {
+            m_impl->textures.push_back(gpu_texture);
+            id = static_cast<TextureID>(m_impl->textures.size());
+        }
+        return { id, width, height };
+    }
+
+    void RendererSDLGPU::update_backend_texture(
+        const Texture texture,
+        const int x, const int y,
+        const int width, const int height,
+        const void* rgba_pixels
+    ) {
+        std::lock_guard lock { m_impl->texture_mutex };
+        if (texture.id == 0 || texture.id > m_impl->textures.size()) return;
+        SDL_GPUTexture* gpu_texture = m_impl->textures[texture.id - 1];
+        if (!gpu_texture) return;
+
+        m_impl->upload_texture(gpu_texture, x, y, width, height, rgba_pixels);
+    }
+
+    void RendererSDLGPU::destroy_backend_texture(const Texture texture) {
+        std::lock_guard lock { m_impl->texture_mutex };
+        if (texture.id == 0 || texture.id > m_impl->textures.size()) return;
+        SDL_GPUTexture*& gpu_texture = m_impl->textures[texture.id - 1];
+        if (!gpu_texture) return;
+
+        // Uploads still staged for it would write to a released texture.
+        std::erase_if(m_impl->staged_uploads, [&](const Impl::StagedUpload& upload) { return upload.texture == gpu_texture; });
+
+        SDL_ReleaseGPUTexture(m_impl->sdl_gpu_device, gpu_texture);
+        gpu_texture = nullptr;
+        m_impl->free_texture_ids.push_back(texture.id);
+    }
+
+    bool RendererSDLGPU::supports_concurrent_uploads() const noexcept {
+        return true;
+    }
+
     void RendererSDLGPU::begin_frame() {
+        // Advance the ring and wait until the GPU is done with the slot's transfer buffer.
+        m_impl->frame_index = (m_impl->frame_index + 1) % FramesInFlight;
+
+        Impl::FrameSlot& frame = m_impl->frames[m_impl->frame_index];
+        if (frame.fence) {
+            SDL_WaitForGPUFences(m_impl->sdl_gpu_device, true, &frame.fence, 1);
+            SDL_ReleaseGPUFence(m_impl->sdl_gpu_device, frame.fence);
+            frame.fence = nullptr;
+        }
     }
 
     void RendererSDLGPU::end_frame() {
+        DrawQueue& queue = get_draw_queue();
+        DrawQueue& screen_queue = get_screen_draw_queue();
+        queue.build_instances();
+        screen_queue.build_instances();
+
+        // Screen space instances follow the world's in the instance buffer.
+        const auto& instances = queue.get_instances();
+        const auto& screen_instances = screen_queue.get_instances();
+        Impl::FrameSlot& frame = m_impl->frames[m_impl->frame_index];
+
+        SDL_GPUCommandBuffer* command_buffer = SDL_AcquireGPUCommandBuffer(m_impl->sdl_gpu_device);
+        if (!command_buffer) {
+            Logger::error(SDL_GetError());
+            queue.clear();
+            screen_queue.clear();
+            return;
+        }
+
+        // Upload the staged data and all instances of the frame through the slot's transfer buffer, in a single copy pass.
+        // Uploads staged from now on go with the next frame.
+        std::unique_lock staging_lock { m_impl->texture_mutex };
+        const auto staged_size = static_cast<std::uint32_t>(Impl::align_staging(m_impl->staging.size()));
+        const auto instance_count = static_cast<std::uint32_t>(instances.size() + screen_instances.size());
+        const std::uint32_t instance_size = instance_count * sizeof(DrawQueue::Instance);
+
+        if (staged_size + instance_size > 0) {
+            m_impl->reserve_instances(instance_count);
+            m_impl->reserve_transfer(frame, staged_size + instance_size);
+
+            auto* mapped = static_cast<std::byte*>(SDL_MapGPUTransferBuffer(m_impl->sdl_gpu_device, frame.transfer_buffer, false));
+            if (!m_impl->staging.empty()) std::memcpy(mapped, m_impl->staging.data(), m_impl->staging.size());
+            if (!instances.empty()) {
+                std::memcpy(mapped + staged_size, instances.data(), instances.size() * sizeof(DrawQueue::Instance));
+            }
+            if (!screen_instances.empty()) {
+                std::memcpy(
+                    mapped + staged_size + instances.size() * sizeof(DrawQueue::Instance),
+                    screen_instances.data(), screen_instances.size() * sizeof(DrawQueue::Instance)
+                );
+            }
+            SDL_UnmapGPUTransferBuffer(m_impl->sdl_gpu_device, frame.transfer_buffer);
+
+            SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+            m_impl->record_staged_uploads(copy_pass, frame.transfer_buffer);
+
+            if (instance_size > 0) {
+                const SDL_GPUTransferBufferLocation source { .transfer_buffer = frame.transfer_buffer, .offset = staged_size };
+                const SDL_GPUBufferRegion destination { .buffer = m_impl->instance_buffer, .offset = 0, .size = instance_size };
+                // Cycling lets SDL hand out a fresh backing buffer if in-flight frames still read the current one.
+                SDL_UploadToGPUBuffer(copy_pass, &source, &destination, true);
+            }
+            SDL_EndGPUCopyPass(copy_pass);
+        }
+        staging_lock.unlock();
+
+        // When threaded, the frame is drawn into the frame target and presented by `present_frame` on the main thread.
+        SDL_GPUTexture* target_texture = nullptr;
+        std::uint32_t target_width = 0, target_height = 0;
+        if (is_threaded()) {
+            target_texture = m_impl->get_frame_target();
+            target_width = m_impl->frame_target_width;
+            target_height = m_impl->frame_target_height;
+        } else if (!SDL_WaitAndAcquireGPUSwapchainTexture(
+            command_buffer, m_impl->sdl_window,
+            &target_texture, &target_width, &target_height
+        )) {
+            Logger::error(SDL_GetError());
+        }
+
+        // The swapchain texture is null while the window is minimized, only the upload is submitted then.
+        if (target_texture) {
+            const Color clear_color = get_clear_color();
+
+            SDL_GPUColorTargetInfo color_target {};
+            color_target.texture = target_texture;
+            color_target.clear_color = {
+                clear_color.r / 255.f, clear_color.g / 255.f,
+                clear_color.b / 255.f, clear_color.a / 255.f
+            };
+            color_target.load_op = SDL_GPU_LOADOP_CLEAR;
+            color_target.store_op = SDL_GPU_STOREOP_STORE;
+            // The main thread may still be copying the previous frame out of the frame target.
+            color_target.cycle = is_threaded();
+
+            SDL_GPURenderPass* render_pass = SDL_BeginGPURenderPass(command_buffer, &color_target, 1, nullptr);
+
+            if (instance_count > 0) {
+                SDL_BindGPUGraphicsPipeline(render_pass, m_impl->sprite_pipeline);
+
+                const SDL_GPUBufferBinding index_binding { .buffer = m_impl->quad_index_buffer, .offset = 0 };
+                SDL_BindGPUIndexBuffer(render_pass, &index_binding, SDL_GPU_INDEXELEMENTSIZE_16BIT);
+
+                const auto draw_pass = [&](const DrawQueue& pass_queue, const View& view, const std::size_t first_instance) {
+                    if (pass_queue.get_instance_batches().empty()) return;
+
+                    const Rect viewport = view.viewport.is_empty()
+                        ? Rect { 0.f, 0.f, static_cast<float>(target_width), static_cast<float>(target_height) }
+                        : view.viewport;
+
+                    const SDL_GPUViewport gpu_viewport {
+                        .x = viewport.x, .y = viewport.y, .w = viewport.width, .h = viewport.height,
+                        .min_depth = 0.f, .max_depth = 1.f
+                    };
+                    SDL_SetGPUViewport(render_pass, &gpu_viewport);
+
+                    // Maps coordinates through the view to viewport pixels (origin top-left), then to clip space.
+                    const glm::vec4 clip_view {
+                        2.f * view.scale.x / viewport.width, -2.f * view.scale.y / viewport.height,
+                        2.f * view.offset.x / viewport.width - 1.f, 1.f - 2.f * view.offset.y / viewport.height
+                    };
+                    SDL_PushGPUVertexUniformData(command_buffer, 0, &clip_view, sizeof(clip_view));
+
+                    for (const DrawQueue::InstanceBatch& batch : pass_queue.get_instance_batches()) {
+                        const std::size_t instance_offset = first_instance + batch.instance_offset;
+                        const std::array<SDL_GPUBufferBinding, 2> vertex_bindings {{
+                            { .buffer = m_impl->quad_vertex_buffer, .offset = 0 },
+                            {
+                                .buffer = m_impl->instance_buffer,
+                                .offset = static_cast<std::uint32_t>(instance_offset * sizeof(DrawQueue::Instance))
+                            },
+                        }};
+                        SDL_BindGPUVertexBuffers(render_pass, 0, vertex_bindings.data(), vertex_bindings.size());
+
+                        const SDL_GPUTextureSamplerBinding sampler_binding {
+                            .texture = m_impl->get_texture(batch.texture),
+                            .sampler = m_impl->sprite_sampler
+                        };
+                        SDL_BindGPUFragmentSamplers(render_pass, 0, &sampler_binding, 1);
+
+                        // One instanced draw per texture run.
+                        SDL_DrawGPUIndexedPrimitives(render_pass, 6, batch.instance_count, 0, 0, 0);
+                    }
+                };
+
+                draw_pass(queue, get_view(), 0);
+                draw_pass(screen_queue, get_screen_view(), instances.size());
+            }
+
+            SDL_EndGPURenderPass(render_pass);
+        }
+
+        frame.fence = SDL_SubmitGPUCommandBufferAndAcquireFence(command_buffer);
+        queue.clear();
+        screen_queue.clear();
+    }
+
+    void RendererSDLGPU::present_frame() {
+        SDL_GPUCommandBuffer* command_buffer = SDL_AcquireGPUCommandBuffer(m_impl->sdl_gpu_device);
+        if (!command_buffer) {
+            Logger::error(SDL_GetError());
+            return;
+        }
+
+        SDL_GPUTexture* swapchain_texture = nullptr;
+        std::uint32_t swapchain_width = 0, swapchain_height = 0;
+        if (!SDL_WaitAndAcquireGPUSwapchainTexture(
+            command_buffer, m_impl->sdl_window,
+            &swapchain_texture, &swapchain_width, &swapchain_height
+        )) {
+            Logger::error(SDL_GetError());
+        }
+
+        // Null while the window is minimized, the next frames are then drawn at the last known size.
+        if (swapchain_texture) {
+            // Read by the render thread, which is idle until the next frame is handed off.
+            m_impl->swapchain_width = swapchain_width;
+            m_impl->swapchain_height = swapchain_height;
+        }
+
+        if (swapchain_texture && m_impl->frame_target) {
+            SDL_GPUBlitInfo blit_info {};
+            blit_info.source = {
+                .texture = m_impl->frame_target,
+                .w = m_impl->frame_target_width, .h = m_impl->frame_target_height
+            };
+            blit_info.destination = { .texture = swapchain_texture, .w = swapchain_width, .h = swapchain_height };
+            blit_info.load_op = SDL_GPU_LOADOP_DONT_CARE;
+            blit_info.filter = SDL_GPU_FILTER_NEAREST;
+            SDL_BlitGPUTexture(command_buffer, &blit_info);
+        } else if (swapchain_texture) {
+            // Nothing was drawn yet, present the clear color rather than undefined contents.
+            const Color clear_color = get_clear_color();
+            SDL_GPUColorTargetInfo color_target {};
+            color_target.texture = swapchain_texture;
+            color_target.clear_color = {
+                clear_color.r / 255.f, clear_color.g / 255.f,
+                clear_color.b / 255.f, clear_color.a / 255.f
+            };
+            color_target.load_op = SDL_GPU_LOADOP_CLEAR;
+            color_target.store_op = SDL_GPU_STOREOP_STORE;
+            SDL_EndGPURenderPass(SDL_BeginGPURenderPass(command_buffer, &color_target, 1, nullptr));
+        }
+
+        // Submitting the command buffer that acquired the swapchain texture presents it.
+        SDL_SubmitGPUCommandBuffer(command_buffer);
     }
-} // vn
\ No newline at end of file
+} // vn
@@ -17,7 +17,13 @@ namespace vn {
         struct Impl;
         std::unique_ptr<Impl> m_impl;
 
+        [[nodiscard]] Texture create_backend_texture(int width, int height, const void* rgba_pixels) override;
+        void update_backend_texture(Texture texture, int x, int y, int width, int height, const void* rgba_pixels) override;
+        void destroy_backend_texture(Texture texture) override;
+        [[nodiscard]] bool supports_concurrent_uploads() const noexcept override;
+
         void begin_frame() override;
         void end_frame() override;
+        void present_frame() override;
     };
-} // vn
\ No newline at end of file
+} // vn
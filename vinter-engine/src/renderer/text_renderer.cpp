@@ -0,0 +1,395 @@
+#include "vinter/text_renderer.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+
+#include "vinter/renderer.hpp"
+#include "vinter/logger.hpp"
+#include "vinter/utils/hash.hpp"
+
+namespace vn {
+    namespace {
+        constexpr int GlyphPadding { 1 };
+        constexpr std::uint32_t NoShelf { std::numeric_limits<std::uint32_t>::max() };
+
+        // Frames a cached layout survives without being drawn or measured.
+        constexpr std::uint64_t LayoutLifetime { 120 };
+        constexpr std::uint64_t InvalidGeneration { std::numeric_limits<std::uint64_t>::max() };
+    }
+
+    struct TextRenderer::Impl {
+        struct Glyph {
+            int advance { 0 };
+            bool visible { false };
+
+            // Atlas placement, NoShelf until rasterized and after eviction.
+            std::uint32_t shelf { NoShelf };
+            glm::ivec2 position {};
+            glm::ivec2 size {};
+        };
+
+        struct Font {
+            TTF_Font* ttf_font;
+            int height;
+            float line_height;
+            std::unordered_map<std::uint32_t, Glyph> glyphs;
+        };
+
+        /**
+         * A row of the atlas holding glyphs of a single font, evicted as a whole.
+         */
+        struct Shelf {
+            int y, height;
+            int next_x { 0 };
+            std::uint32_t font;
+            std::uint64_t last_used { 0 };
+            std::vector<std::uint32_t> codepoints;
+        };
+
+        struct Layout {
+            std::string text;
+            std::uint32_t font { 0 };
+            std::vector<Vertex> vertices; // White, relative to the text position.
+            std::vector<std::uint32_t> shelves;
+            glm::vec2 size {};
+            std::uint64_t generation { InvalidGeneration };
+            std::uint64_t last_used { 0 };
+        };
+
+        Renderer& renderer;
+        int atlas_size;
+        Texture atlas {};
+
+        // A copy of the atlas pixels, glyphs are rasterized into it and uploaded once per frame.
+        std::vector<std::uint8_t> atlas_pixels;
+        glm::ivec2 dirty_min { std::numeric_limits<int>::max() };
+        glm::ivec2 dirty_max { 0 };
+
+        std::vector<Font> fonts;
+        std::vector<Shelf> shelves;
+        int next_shelf_y { 0 };
+
+        std::unordered_map<std::uint64_t, Layout> layouts;
+        std::vector<Vertex> scratch_vertices;
+        std::vector<std::uint8_t> scratch_pixels;
+
+        std::uint64_t frame { 1 };
+        // Bumped on every eviction, invalidating the cached layouts.
+        std::uint64_t generation { 0 };
+        bool reported_full { false };
+
+        Impl(Renderer& renderer, const int atlas_size)
+            : renderer(renderer), atlas_size(atlas_size) {
+            if (!TTF_Init()) throw std::runtime_error(SDL_GetError());
+        }
+
+        /**
+         * Takes ownership of an opened font, closing it if it does not fit the atlas.
+         */
+        FontHandle add_font(TTF_Font* ttf_font, const std::string_view name) {
+            const int height = TTF_GetFontHeight(ttf_font);
+            if (height + GlyphPadding > atlas_size) {
+                Logger::error("Font is too large for the glyph atlas: " + std::string { name });
+                TTF_CloseFont(ttf_font);
+                return {};
+            }
+
+            fonts.push_back({ ttf_font, height, static_cast<float>(TTF_GetFontLineSkip(ttf_font)) });
+            return { static_cast<std::uint32_t>(fonts.size() - 1) };
+        }
+
+        ~Impl() {
+            for (const Font& font : fonts) {
+                TTF_CloseFont(font.ttf_font);
+            }
+            if (atlas.is_valid()) renderer.destroy_texture(atlas);
+            TTF_Quit();
+        }
+
+        Glyph& get_glyph(const std::uint32_t font_index, const std::uint32_t codepoint) {
+            Font& font = fonts[font_index];
+            const auto [it, inserted] = font.glyphs.try_emplace(codepoint);
+            Glyph& glyph = it->second;
+
+            if (inserted) {
+                int min_x, max_x, min_y, max_y;
+                if (TTF_GetGlyphMetrics(font.ttf_font, codepoint, &min_x, &max_x, &min_y, &max_y, &glyph.advance)) {
+                    glyph.visible = max_x > min_x && max_y > min_y;
+                }
+            }
+            return glyph;
+        }
+
+        /**
+         * Finds room for a glyph in a shelf of its font, opening a new shelf or evicting the least recently
+         * used one if needed. Shelves used this frame are never evicted, since queued quads still sample them.
+         */
+        std::uint32_t find_shelf(const std::uint32_t font_index, const int width, const int height) {
+            const int shelf_height = fonts[font_index].height + GlyphPadding;
+
+            for (std::uint32_t i = 0; i < shelves.size(); ++i) {
+                const Shelf& shelf = shelves[i];
+                if (shelf.font == font_index && shelf.height >= height && shelf.next_x + width <= atlas_size) {
+                    return i;
+                }
+            }
+
+            if (next_shelf_y + shelf_height <= atlas_size) {
+                shelves.push_back({ next_shelf_y, shelf_height, 0, font_index });
+                next_shelf_y += shelf_height;
+                return static_cast<std::uint32_t>(shelves.size() - 1);
+            }
+
+            std::uint32_t victim = NoShelf;
+            for (std::uint32_t i = 0; i < shelves.size(); ++i) {
+                const Shelf& shelf = shelves[i];
+                if (shelf.last_used == frame || shelf.height < height) continue;
+                if (victim == NoShelf || shelf.last_used < shelves[victim].last_used) victim = i;
+            }
+            if (victim == NoShelf) return NoShelf;
+
+            Shelf& shelf = shelves[victim];
+            for (const std::uint32_t codepoint : shelf.codepoints) {
+                fonts[shelf.font].glyphs[codepoint].shelf = NoShelf;
+            }
+            shelf.codepoints.clear();
+            shelf.font = font_index;
+            shelf.next_x = 0;
+            ++generation;
+            return victim;
+        }
+
+        bool rasterize(const std::uint32_t font_index, const std::uint32_t codepoint, Glyph& glyph) {
+            if (!atlas.is_valid()) {
+                atlas_pixels.assign(static_cast<std::size_t>(atlas_size) * atlas_size * 4, 0);
+                atlas = renderer.create_texture(atlas_size, atlas_size, atlas_pixels.data());
+                if (!atlas.is_valid()) return false;
+            }
+
+            // Rendered white, the text color is applied through the vertex color.
+            SDL_Surface* surface = TTF_RenderGlyph_Blended(fonts[font_index].ttf_font, codepoint, { 255, 255, 255, 255 });
+            if (!surface) {
+                Logger::error(SDL_GetError());
+                return false;
+            }
+            SDL_Surface* rgba_surface = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+            SDL_DestroySurface(surface);
+            if (!rgba_surface) {
+                Logger::error(SDL_GetError());
+                return false;
+            }
+
+            const int width = rgba_surface->w;
+            const int height = rgba_surface->h;
+            const std::uint32_t shelf_index = find_shelf(font_index, width + GlyphPadding, height + GlyphPadding);
+            if (shelf_index == NoShelf) {
+                if (!reported_full) {
+                    Logger::warning("Glyph atlas is full with glyphs drawn this frame, consider a larger atlas.");
+                    reported_full = true;
+                }
+                SDL_DestroySurface(rgba_surface);
+                return false;
+            }
+
+            Shelf& shelf = shelves[shelf_index];
+            const std::size_t atlas_offset = (static_cast<std::size_t>(shelf.y) * atlas_size + shelf.next_x) * 4;
+            SDL_ConvertPixels(
+                width, height,
+                SDL_PIXELFORMAT_RGBA32, rgba_surface->pixels, rgba_surface->pitch,
+                SDL_PIXELFORMAT_RGBA32, atlas_pixels.data() + atlas_offset, atlas_size * 4
+            );
+            SDL_DestroySurface(rgba_surface);
+
+            dirty_min = glm::min(dirty_min, glm::ivec2 { shelf.next_x, shelf.y });
+            dirty_max = glm::max(dirty_max, glm::ivec2 { shelf.next_x + width, shelf.y + height });
+
+            glyph.shelf = shelf_index;
+            glyph.position = { shelf.next_x, shelf.y };
+            glyph.size = { width, height };
+            shelf.next_x += width + GlyphPadding;
+            shelf.codepoints.push_back(codepoint);
+            return true;
+        }
+
+        void build_layout(Layout& layout) {
+            const Font& font = fonts[layout.font];
+            layout.vertices.clear();
+            layout.shelves.clear();
+
+            const glm::vec2 uv_scale { 1.f / static_cast<float>(atlas_size) };
+            const glm::vec4 white { 1.f };
+
+            glm::vec2 pen {};
+            float width = 0.f;
+            int line_count = 1;
+            std::uint32_t previous = 0;
+            bool complete = true;
+
+            const char* cursor = layout.text.data();
+            std::size_t remaining = layout.text.size();
+            while (remaining > 0) {
+                const std::uint32_t codepoint = SDL_StepUTF8(&cursor, &remaining);
+                if (codepoint == '\n') {
+                    width = std::max(width, pen.x);
+                    pen = { 0.f, pen.y + font.line_height };
+                    previous = 0;
+                    ++line_count;
+                    continue;
+                }
+
+                if (int kerning = 0; previous != 0 && TTF_GetGlyphKerning(font.ttf_font, previous, codepoint, &kerning)) {
+                    pen.x += static_cast<float>(kerning);
+                }
+
+                Glyph& glyph = get_glyph(layout.font, codepoint);
+                if (glyph.visible && glyph.shelf == NoShelf && !rasterize(layout.font, codepoint, glyph)) {
+                    complete = false;
+                } else if (glyph.visible) {
+                    // Mark the shelf right away, so that later glyphs of this text cannot evict it.
+                    shelves[glyph.shelf].last_used = frame;
+                    layout.shelves.push_back(glyph.shelf);
+
+                    const glm::vec2 min = pen;
+                    const glm::vec2 max = pen + glm::vec2 { glyph.size };
+                    const glm::vec2 uv_min = glm::vec2 { glyph.position } * uv_scale;
+                    const glm::vec2 uv_max = glm::vec2 { glyph.position + glyph.size } * uv_scale;
+
+                    layout.vertices.push_back({ { min.x, min.y }, white, { uv_min.x, uv_min.y } });
+                    layout.vertices.push_back({ { max.x, min.y }, white, { uv_max.x, uv_min.y } });
+                    layout.vertices.push_back({ { max.x, max.y }, white, { uv_max.x, uv_max.y } });
+                    layout.vertices.push_back({ { min.x, max.y }, white, { uv_min.x, uv_max.y } });
+                }
+
+                pen.x += static_cast<float>(glyph.advance);
+                previous = codepoint;
+            }
+
+            std::ranges::sort(layout.shelves);
+            const auto [first, last] = std::ranges::unique(layout.shelves);
+            layout.shelves.erase(first, last);
+
+            layout.size = { std::max(width, pen.x), static_cast<float>(line_count) * font.line_height };
+            // Incomplete layouts are rebuilt next time, in case room has been made for their missing glyphs.
+            layout.generation = complete ? generation : InvalidGeneration;
+        }
+
+        /**
+         * Uploads the bounding box of the glyphs rasterized since the last upload, in a single texture update.
+         */
+        void upload_dirty_region() {
+            if (dirty_max.x <= dirty_min.x || dirty_max.y <= dirty_min.y) return;
+
+            const glm::ivec2 size = dirty_max - dirty_min;
+            const auto row_size = static_cast<std::size_t>(size.x) * 4;
+            scratch_pixels.resize(row_size * size.y);
+            for (int y = 0; y < size.y; ++y) {
+                const std::size_t atlas_offset = (static_cast<std::size_t>(dirty_min.y + y) * atlas_size + dirty_min.x) * 4;
+                std::copy_n(atlas_pixels.data() + atlas_offset, row_size, scratch_pixels.data() + y * row_size);
+            }
+            renderer.update_texture(atlas, dirty_min.x, dirty_min.y, size.x, size.y, scratch_pixels.data());
+
+            dirty_min = glm::ivec2 { std::numeric_limits<int>::max() };
+            dirty_max = glm::ivec2 { 0 };
+        }
+
+        Layout& get_layout(const std::uint32_t font_index, const std::string_view text) {
+            const std::uint64_t key = fnv1a_64(text) ^ (font_index + 1ull) * 0x9E3779B97F4A7C15ull;
+            Layout& layout = layouts[key];
+
+            if (layout.generation != generation || layout.font != font_index || layout.text != text) {
+                layout.text.assign(text);
+                layout.font = font_index;
+                build_layout(layout);
+            } else {
+                for (const std::uint32_t shelf : layout.shelves) {
+                    shelves[shelf].last_used = frame;
+                }
+            }
+            layout.last_used = frame;
+            return layout;
+        }
+    };
+
+    TextRenderer::TextRenderer(Renderer& renderer, const int atlas_size)
+        : m_impl(std::make_unique<Impl>(renderer, atlas_size)) {}
+
+    TextRenderer::~TextRenderer() = default;
+
+    FontHandle TextRenderer::load_font(const std::string_view path, const float size) {
+        TTF_Font* ttf_font = TTF_OpenFont(std::string { path }.c_str(), size);
+        if (!ttf_font) {
+            Logger::error(SDL_GetError());
+            return {};
+        }
+
+        return m_impl->add_font(ttf_font, path);
+    }
+
+    FontHandle TextRenderer::load_font(const std::span<const std::byte> data, const float size) {
+        SDL_IOStream* stream = SDL_IOFromConstMem(data.data(), data.size());
+        if (!stream) {
+            Logger::error(SDL_GetError());
+            return {};
+        }
+
+        // Closes the stream along with the font, the data itself is only borrowed.
+        TTF_Font* ttf_font = TTF_OpenFontIO(stream, true, size);
+        if (!ttf_font) {
+            Logger::error(SDL_GetError());
+            return {};
+        }
+
+        return m_impl->add_font(ttf_font, "<memory>");
+    }
+
+    void TextRenderer::draw_text(
+        const FontHandle font,
+        const std::string_view text,
+        const glm::vec2 position,
+        const Color color,
+        const std::int32_t layer
+    ) {
+        if (!font.is_valid() || text.empty()) return;
+
+        const Impl::Layout& layout = m_impl->get_layout(font.index, text);
+        if (layout.vertices.empty()) return;
+
+        const glm::vec4 vertex_color { color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f };
+        std::vector<Vertex>& vertices = m_impl->scratch_vertices;
+        vertices.resize(layout.vertices.size());
+        for (std::size_t i = 0; i < vertices.size(); ++i) {
+            vertices[i] = { layout.vertices[i].position + position, vertex_color, layout.vertices[i].uv };
+        }
+        m_impl->renderer.draw_screen_quads(m_impl->atlas, layer, vertices);
+    }
+
+    glm::vec2 TextRenderer::measure_text(const FontHandle font, const std::string_view text) {
+        if (!font.is_valid() || text.empty()) return {};
+        return m_impl->get_layout(font.index, text).size;
+    }
+
+    float TextRenderer::get_line_height(const FontHandle font) const {
+        return font.is_valid() ? m_impl->fonts[font.index].line_height : 0.f;
+    }
+
+    void TextRenderer::end_frame() {
+        m_impl->upload_dirty_region();
+    }
+
+    void TextRenderer::begin_frame() {
+        ++m_impl->frame;
+
+        if (m_impl->frame % LayoutLifetime == 0) {
+            std::erase_if(m_impl->layouts, [&](const auto& entry) {
+                return entry.second.last_used + LayoutLifetime < m_impl->frame;
+            });
+        }
+    }
+} // vn
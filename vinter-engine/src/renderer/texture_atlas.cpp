@@ -0,0 +1,165 @@
+#include "vinter/texture_atlas.hpp"
+
+#include <algorithm>
+
+#include "vinter/renderer.hpp"
+#include "vinter/logger.hpp"
+#include "vinter/utils/hash.hpp"
+#include "image.hpp"
+
+namespace vn {
+    namespace {
+        /**
+         * Copies an image into a buffer `padding` pixels larger on every side, repeating its edge pixels.
+         */
+        std::vector<std::uint32_t> extrude(const int width, const int height, const void* rgba_pixels, const int padding) {
+            const auto* pixels = static_cast<const std::uint32_t*>(rgba_pixels);
+            const int padded_width = width + 2 * padding;
+            const int padded_height = height + 2 * padding;
+
+            std::vector<std::uint32_t> padded(static_cast<std::size_t>(padded_width) * padded_height);
+            for (int y = 0; y < padded_height; ++y) {
+                const int source_y = std::clamp(y - padding, 0, height - 1);
+                for (int x = 0; x < padded_width; ++x) {
+                    const int source_x = std::clamp(x - padding, 0, width - 1);
+                    padded[static_cast<std::size_t>(y) * padded_width + x] = pixels[static_cast<std::size_t>(source_y) * width + source_x];
+                }
+            }
+            return padded;
+        }
+    }
+
+    TextureAtlas::TextureAtlas(Renderer& renderer, const int page_size, const int padding)
+        : m_renderer(renderer), m_page_size(page_size), m_padding(padding) {}
+
+    TextureAtlas::~TextureAtlas() {
+        for (const Page& page : m_pages) {
+            m_renderer.destroy_texture(page.texture);
+        }
+    }
+
+    AtlasHandle TextureAtlas::load(const std::string_view path) {
+        if (const AtlasHandle handle = find(path); handle.is_valid()) return handle;
+
+        Image image;
+        if (!load_image(path, image)) return {};
+
+        const AtlasHandle handle = add(image.width, image.height, image.pixels.data());
+        if (handle.is_valid()) {
+            add_path(path, handle);
+        }
+        return handle;
+    }
+
+    AtlasHandle TextureAtlas::load(const std::string_view name, const std::span<const std::byte> data) {
+        if (const AtlasHandle handle = find(name); handle.is_valid()) return handle;
+
+        Image image;
+        if (!load_image(data, image)) return {};
+
+        const AtlasHandle handle = add(image.width, image.height, image.pixels.data());
+        if (handle.is_valid()) {
+            add_path(name, handle);
+        }
+        return handle;
+    }
+
+    std::vector<AtlasHandle> TextureAtlas::load(const std::span<const std::string_view> paths) {
+        std::vector<AtlasHandle> handles(paths.size());
+        std::vector<Image> images(paths.size());
+        std::vector<std::size_t> order;
+
+        for (std::size_t i = 0; i < paths.size(); ++i) {
+            handles[i] = find(paths[i]);
+            if (!handles[i].is_valid() && load_image(paths[i], images[i])) {
+                order.push_back(i);
+            }
+        }
+
+        // Tallest first keeps the skyline flat, which wastes the least space.
+        std::ranges::stable_sort(order, std::greater {}, [&](const std::size_t i) { return images[i].height; });
+
+        for (const std::size_t i : order) {
+            // The same path may appear twice in one call.
+            if (const AtlasHandle handle = find(paths[i]); handle.is_valid()) {
+                handles[i] = handle;
+                continue;
+            }
+
+            handles[i] = add(images[i].width, images[i].height, images[i].pixels.data());
+            if (handles[i].is_valid()) {
+                add_path(paths[i], handles[i]);
+            }
+        }
+        return handles;
+    }
+
+    AtlasHandle TextureAtlas::add(const int width, const int height, const void* rgba_pixels) {
+        if (width <= 0 || height <= 0 || !rgba_pixels) return {};
+
+        std::size_t page;
+        glm::ivec2 position;
+        if (!allocate(width + 2 * m_padding, height + 2 * m_padding, page, position)) return {};
+
+        const std::vector<std::uint32_t> padded = extrude(width, height, rgba_pixels, m_padding);
+        m_renderer.update_texture(
+            m_pages[page].texture,
+            position.x, position.y,
+            width + 2 * m_padding, height + 2 * m_padding,
+            padded.data()
+        );
+
+        const AtlasHandle handle { static_cast<std::uint32_t>(m_regions.size()) };
+        m_regions.push_back({
+            .texture = m_pages[page].texture,
+            .source = {
+                static_cast<float>(position.x + m_padding), static_cast<float>(position.y + m_padding),
+                static_cast<float>(width), static_cast<float>(height)
+            },
+        });
+        return handle;
+    }
+
+    AtlasHandle TextureAtlas::find(const std::string_view path) const {
+        const auto [first, last] = m_path_lookup.equal_range(fnv1a_64(path));
+        for (auto it = first; it != last; ++it) {
+            if (m_region_paths[it->second.index] == path) return it->second;
+        }
+        return {};
+    }
+
+    void TextureAtlas::add_path(const std::string_view path, const AtlasHandle handle) {
+        if (m_region_paths.size() <= handle.index) m_region_paths.resize(handle.index + 1);
+        m_region_paths[handle.index] = path;
+        m_path_lookup.emplace(fnv1a_64(path), handle);
+    }
+
+    const AtlasRegion& TextureAtlas::get_region(const AtlasHandle handle) const {
+        return m_regions[handle.index];
+    }
+
+    bool TextureAtlas::allocate(const int width, const int height, std::size_t& page, glm::ivec2& position) {
+        for (page = 0; page < m_pages.size(); ++page) {
+            if (const auto found = m_pages[page].packer.insert(width, height)) {
+                position = *found;
+                return true;
+            }
+        }
+
+        // Oversized images get a page of their own, sized to fit.
+        const int page_width = std::max(m_page_size, width);
+        const int page_height = std::max(m_page_size, height);
+
+        const std::vector<std::uint32_t> blank(static_cast<std::size_t>(page_width) * page_height, 0);
+        const Texture texture = m_renderer.create_texture(page_width, page_height, blank.data());
+        if (!texture.is_valid()) {
+            Logger::error("Failed to create texture atlas page.");
+            return false;
+        }
+
+        Page& new_page = m_pages.emplace_back(texture, SkylinePacker { page_width, page_height });
+        page = m_pages.size() - 1;
+        position = *new_page.packer.insert(width, height);
+        return true;
+    }
+} // vn
@@ -0,0 +1,91 @@
+#include "vinter/skyline_packer.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace vn {
+    SkylinePacker::SkylinePacker(const int width, const int height)
+        : m_width(width), m_height(height) {
+        clear();
+    }
+
+    void SkylinePacker::clear() {
+        m_skyline.clear();
+        m_skyline.push_back({ 0, 0, m_width });
+        m_used_area = 0;
+    }
+
+    float SkylinePacker::get_occupancy() const noexcept {
+        const auto area = static_cast<float>(m_width) * static_cast<float>(m_height);
+        return area > 0.f ? static_cast<float>(m_used_area) / area : 0.f;
+    }
+
+    std::optional<int> SkylinePacker::fit(const std::size_t index, const int width, const int height) const {
+        if (m_skyline[index].x + width > m_width) return std::nullopt;
+
+        // The rectangle rests on the highest segment below its span.
+        int y = 0;
+        int remaining = width;
+        for (std::size_t i = index; remaining > 0; ++i) {
+            y = std::max(y, m_skyline[i].y);
+            if (y + height > m_height) return std::nullopt;
+            remaining -= m_skyline[i].width;
+        }
+        return y;
+    }
+
+    std::optional<glm::ivec2> SkylinePacker::insert(const int width, const int height) {
+        if (width <= 0 || height <= 0) return std::nullopt;
+
+        std::size_t best_index = m_skyline.size();
+        int best_top = std::numeric_limits<int>::max();
+        int best_segment_width = std::numeric_limits<int>::max();
+        int best_y = 0;
+
+        for (std::size_t i = 0; i < m_skyline.size(); ++i) {
+            const std::optional<int> y = fit(i, width, height);
+            if (!y) continue;
+
+            const int top = *y + height;
+            if (top < best_top || (top == best_top && m_skyline[i].width < best_segment_width)) {
+                best_index = i;
+                best_top = top;
+                best_segment_width = m_skyline[i].width;
+                best_y = *y;
+            }
+        }
+        if (best_index == m_skyline.size()) return std::nullopt;
+
+        const glm::ivec2 position { m_skyline[best_index].x, best_y };
+        m_skyline.insert(m_skyline.begin() + static_cast<std::ptrdiff_t>(best_index), { position.x, best_top, width });
+
+        // Trim the segments now covered by the new one.
+        const int right = position.x + width;
+        for (std::size_t i = best_index + 1; i < m_skyline.size();) {
+            Segment& segment = m_skyline[i];
+            if (segment.x >= right) break;
+
+            const int overlap = right - segment.x;
+            if (overlap >= segment.width) {
+                m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i));
+                continue;
+            }
+            segment.x += overlap;
+            segment.width -= overlap;
+            break;
+        }
+
+        // Merge neighbours at the same height.
+        for (std::size_t i = 0; i + 1 < m_skyline.size();) {
+            if (m_skyline[i].y == m_skyline[i + 1].y) {
+                m_skyline[i].width += m_skyline[i + 1].width;
+                m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            } else {
+                ++i;
+            }
+        }
+
+        m_used_area += static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+        return position;
+    }
+} // vn
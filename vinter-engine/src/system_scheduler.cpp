@@ -0,0 +1,171 @@
+#include "vinter/system_scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+
+#include "vinter/job_system.hpp"
+#include "vinter/profiler.hpp"
+
+namespace vn {
+    namespace {
+        constexpr std::size_t NoSystem { std::numeric_limits<std::size_t>::max() };
+    }
+
+    struct SystemScheduler::Impl {
+        struct System {
+            const char* name;
+            SystemAccess access;
+            SystemFunction function;
+            std::vector<std::size_t> successors;
+            std::uint32_t dependency_count { 0 };
+        };
+
+        entt::registry& registry;
+        JobSystem& jobs;
+
+        std::vector<System> systems;
+        // Unfinished dependencies of each system during a run.
+        std::unique_ptr<std::atomic<std::uint32_t>[]> remaining;
+        bool dirty { false };
+
+        Impl(entt::registry& registry, JobSystem& jobs)
+            : registry(registry), jobs(jobs) {}
+
+        static void sort_access(std::vector<ComponentAccess>& accesses) {
+            std::ranges::sort(accesses, {}, &ComponentAccess::id);
+            const auto [first, last] = std::ranges::unique(accesses, {}, &ComponentAccess::id);
+            accesses.erase(first, last);
+        }
+
+        /**
+         * Links every system to the closest earlier systems it conflicts with, so that any two conflicting
+         * systems are ordered through some path without connecting every such pair directly.
+         */
+        void build_graph() {
+            struct ComponentState {
+                std::size_t last_writer { NoSystem };
+                std::vector<std::size_t> readers; // Since the last writer.
+            };
+
+            std::unordered_map<entt::id_type, ComponentState> components;
+            std::size_t last_exclusive = NoSystem;
+            std::vector<std::size_t> since_exclusive;
+            std::vector<std::size_t> dependencies;
+
+            for (System& system : systems) {
+                system.successors.clear();
+                system.dependency_count = 0;
+            }
+
+            for (std::size_t i = 0; i < systems.size(); ++i) {
+                const SystemAccess& access = systems[i].access;
+                dependencies.clear();
+                dependencies.push_back(last_exclusive);
+
+                if (access.exclusive) {
+                    dependencies.insert(dependencies.end(), since_exclusive.begin(), since_exclusive.end());
+                    components.clear();
+                    since_exclusive.clear();
+                    last_exclusive = i;
+                } else {
+                    for (const ComponentAccess& read : access.reads) {
+                        ComponentState& state = components[read.id];
+                        dependencies.push_back(state.last_writer);
+                        state.readers.push_back(i);
+                    }
+                    for (const ComponentAccess& write : access.writes) {
+                        ComponentState& state = components[write.id];
+                        dependencies.push_back(state.last_writer);
+                        dependencies.insert(dependencies.end(), state.readers.begin(), state.readers.end());
+                        state.last_writer = i;
+                        state.readers.clear();
+                    }
+                    since_exclusive.push_back(i);
+                }
+
+                std::ranges::sort(dependencies);
+                const auto [first, last] = std::ranges::unique(dependencies);
+                dependencies.erase(first, last);
+
+                for (const std::size_t dependency : dependencies) {
+                    if (dependency == NoSystem) continue;
+                    systems[dependency].successors.push_back(i);
+                    ++systems[i].dependency_count;
+                }
+            }
+
+            remaining = std::make_unique<std::atomic<std::uint32_t>[]>(systems.size());
+            dirty = false;
+        }
+
+        void schedule_system(JobCounter& frame, const std::size_t index, const float delta) {
+            jobs.schedule(frame, [this, &frame, index, delta] {
+                run_system(frame, index, delta);
+            });
+        }
+
+        void run_system(JobCounter& frame, const std::size_t index, const float delta) {
+            const System& system = systems[index];
+            {
+                VN_PROFILE_ZONE(system.name);
+                system.function(registry, delta);
+            }
+
+            for (const std::size_t successor : system.successors) {
+                if (remaining[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    schedule_system(frame, successor, delta);
+                }
+            }
+        }
+    };
+
+    SystemScheduler::SystemScheduler(entt::registry& registry, JobSystem& jobs)
+        : m_impl(std::make_unique<Impl>(registry, jobs)) {}
+
+    SystemScheduler::~SystemScheduler() = default;
+
+    std::size_t SystemScheduler::get_system_count() const noexcept {
+        return m_impl->systems.size();
+    }
+
+    void SystemScheduler::add_system(const char* name, SystemAccess access, SystemFunction function) {
+        Impl::sort_access(access.reads);
+        Impl::sort_access(access.writes);
+
+        // Writing a component implies reading it.
+        std::erase_if(access.reads, [&](const ComponentAccess& read) {
+            return std::ranges::binary_search(access.writes, read.id, {}, &ComponentAccess::id);
+        });
+
+        // Create the storages upfront, since views would otherwise create them lazily while running concurrently.
+        for (const ComponentAccess& read : access.reads) read.assure(m_impl->registry);
+        for (const ComponentAccess& write : access.writes) write.assure(m_impl->registry);
+
+        m_impl->systems.push_back({ name, std::move(access), std::move(function) });
+        m_impl->dirty = true;
+    }
+
+    void SystemScheduler::run(const float delta) {
+        if (m_impl->dirty) {
+            m_impl->build_graph();
+        }
+
+        auto& systems = m_impl->systems;
+        if (systems.empty()) return;
+
+        for (std::size_t i = 0; i < systems.size(); ++i) {
+            m_impl->remaining[i].store(systems[i].dependency_count, std::memory_order_relaxed);
+        }
+
+        JobCounter frame;
+        for (std::size_t i = 0; i < systems.size(); ++i) {
+            if (systems[i].dependency_count == 0) {
+                m_impl->schedule_system(frame, i, delta);
+            }
+        }
+        m_impl->jobs.wait(frame);
+    }
+} // vn
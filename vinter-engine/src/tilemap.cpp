@@ -0,0 +1,132 @@
+#include "vinter/tilemap.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "vinter/renderer.hpp"
+
+namespace vn {
+    Tilemap::Tilemap(const int width, const int height, const Tileset& tileset, const glm::vec2 tile_size)
+        : m_width(std::max(width, 0)), m_height(std::max(height, 0)),
+          m_chunk_columns((m_width + ChunkSize - 1) / ChunkSize),
+          m_chunk_rows((m_height + ChunkSize - 1) / ChunkSize),
+          m_tileset(tileset),
+          m_tile_size(tile_size),
+          m_tiles(static_cast<std::size_t>(m_width) * m_height, 0),
+          m_chunks(static_cast<std::size_t>(m_chunk_columns) * m_chunk_rows) {
+    }
+
+    TileID Tilemap::get_tile(const int x, const int y) const noexcept {
+        if (x < 0 || y < 0 || x >= m_width || y >= m_height) return 0;
+        return m_tiles[static_cast<std::size_t>(y) * m_width + x];
+    }
+
+    void Tilemap::set_tile(const int x, const int y, const TileID tile) noexcept {
+        if (x < 0 || y < 0 || x >= m_width || y >= m_height) return;
+
+        TileID& current = m_tiles[static_cast<std::size_t>(y) * m_width + x];
+        if (current == tile) return;
+
+        current = tile;
+        m_chunks[static_cast<std::size_t>(y / ChunkSize) * m_chunk_columns + x / ChunkSize].dirty = true;
+    }
+
+    void Tilemap::fill(const TileID tile) noexcept {
+        std::ranges::fill(m_tiles, tile);
+        mark_all_dirty();
+    }
+
+    void Tilemap::set_tileset(const Tileset& tileset) noexcept {
+        m_tileset = tileset;
+        mark_all_dirty();
+    }
+
+    glm::ivec2 Tilemap::world_to_tile(const glm::vec2 world_position) const noexcept {
+        const glm::vec2 local = (world_position - position) / m_tile_size;
+        return { static_cast<int>(std::floor(local.x)), static_cast<int>(std::floor(local.y)) };
+    }
+
+    void Tilemap::draw(Renderer& renderer, const Rect& view) {
+        const glm::vec4 color { tint.r / 255.f, tint.g / 255.f, tint.b / 255.f, tint.a / 255.f };
+        if (position != m_built_position || color != m_built_color) {
+            m_built_position = position;
+            m_built_color = color;
+            mark_all_dirty();
+        }
+
+        // Chunk range overlapping the view, clamped to the map.
+        const glm::vec2 chunk_world_size = m_tile_size * static_cast<float>(ChunkSize);
+        const glm::vec2 view_min = (view.get_position() - position) / chunk_world_size;
+        const glm::vec2 view_max = (view.get_position() + view.get_size() - position) / chunk_world_size;
+
+        const int first_x = std::max(0, static_cast<int>(std::floor(view_min.x)));
+        const int first_y = std::max(0, static_cast<int>(std::floor(view_min.y)));
+        const int last_x = std::min(m_chunk_columns - 1, static_cast<int>(std::ceil(view_max.x)) - 1);
+        const int last_y = std::min(m_chunk_rows - 1, static_cast<int>(std::ceil(view_max.y)) - 1);
+
+        for (int chunk_y = first_y; chunk_y <= last_y; ++chunk_y) {
+            for (int chunk_x = first_x; chunk_x <= last_x; ++chunk_x) {
+                Chunk& chunk = m_chunks[static_cast<std::size_t>(chunk_y) * m_chunk_columns + chunk_x];
+                if (chunk.dirty) {
+                    build_chunk(chunk_x, chunk_y);
+                }
+                renderer.draw_quads(m_tileset.texture, layer, chunk.vertices);
+            }
+        }
+    }
+
+    void Tilemap::mark_all_dirty() noexcept {
+        for (Chunk& chunk : m_chunks) {
+            chunk.dirty = true;
+        }
+    }
+
+    void Tilemap::build_chunk(const int chunk_x, const int chunk_y) {
+        Chunk& chunk = m_chunks[static_cast<std::size_t>(chunk_y) * m_chunk_columns + chunk_x];
+        chunk.vertices.clear();
+        chunk.dirty = false;
+
+        const Texture& texture = m_tileset.texture;
+        Rect region = m_tileset.region;
+        if (region.is_empty()) {
+            region = { 0.f, 0.f, static_cast<float>(texture.width), static_cast<float>(texture.height) };
+        }
+
+        const int columns = std::max(1, static_cast<int>(region.width) / std::max(1, m_tileset.tile_size.x));
+        const glm::vec2 texture_size { std::max(texture.width, 1), std::max(texture.height, 1) };
+        const glm::vec2 uv_tile_size = glm::vec2 { m_tileset.tile_size } / texture_size;
+        const bool textured = texture.is_valid() && texture.width > 0 && texture.height > 0;
+
+        const int begin_x = chunk_x * ChunkSize;
+        const int begin_y = chunk_y * ChunkSize;
+        const int end_x = std::min(begin_x + ChunkSize, m_width);
+        const int end_y = std::min(begin_y + ChunkSize, m_height);
+
+        for (int y = begin_y; y < end_y; ++y) {
+            for (int x = begin_x; x < end_x; ++x) {
+                const TileID tile = m_tiles[static_cast<std::size_t>(y) * m_width + x];
+                if (tile == 0) continue;
+
+                const glm::vec2 min = m_built_position + glm::vec2 { x, y } * m_tile_size;
+                const glm::vec2 max = min + m_tile_size;
+
+                glm::vec2 uv_min { 0.f };
+                glm::vec2 uv_max { 0.f };
+                if (textured) {
+                    const int index = tile - 1;
+                    const glm::vec2 pixel {
+                        region.x + static_cast<float>(index % columns * m_tileset.tile_size.x),
+                        region.y + static_cast<float>(index / columns * m_tileset.tile_size.y)
+                    };
+                    uv_min = pixel / texture_size;
+                    uv_max = uv_min + uv_tile_size;
+                }
+
+                chunk.vertices.push_back({ { min.x, min.y }, m_built_color, { uv_min.x, uv_min.y } });
+                chunk.vertices.push_back({ { max.x, min.y }, m_built_color, { uv_max.x, uv_min.y } });
+                chunk.vertices.push_back({ { max.x, max.y }, m_built_color, { uv_max.x, uv_max.y } });
+                chunk.vertices.push_back({ { min.x, max.y }, m_built_color, { uv_min.x, uv_max.y } });
+            }
+        }
+    }
+} // vn
@@ -1,19 +1,53 @@
 #include "vinter/time.hpp"
 
+#include <cmath>
+#include <stdexcept>
+
 #include <SDL3/SDL.h>
 
 namespace vn {
-    Time::Time()
-        : m_tick_current(SDL_GetPerformanceCounter())
+    Time::Time(const TimeSettings& time_settings)
+        : m_settings(time_settings)
+        , m_tick_current(SDL_GetPerformanceCounter())
         , m_frequency(SDL_GetPerformanceFrequency()) {
+        // Also rejects NaN, either would never let `consume_fixed_step` drain the accumulator.
+        if (!(m_settings.fixed_delta > 0.f)) throw std::runtime_error("TimeSettings::fixed_delta must be positive.");
+        // Otherwise every fixed step would be dropped as backlog, and `fixed_update` would never run.
+        if (m_settings.max_fixed_steps <= 0) throw std::runtime_error("TimeSettings::max_fixed_steps must be positive.");
     }
 
-    void Time::update() {
+    float Time::measure_delta() {
         m_tick_previous = m_tick_current;
         m_tick_current = SDL_GetPerformanceCounter();
 
-        m_delta = static_cast<float>(m_tick_current - m_tick_previous) /
-                  static_cast<float>(m_frequency);
+        return static_cast<float>(m_tick_current - m_tick_previous) /
+               static_cast<float>(m_frequency);
+    }
+
+    void Time::advance(const float delta) {
+        m_delta = delta;
+
+        if (m_settings.fixed_timestep) {
+            m_accumulator += m_delta;
+            m_fixed_steps = 0;
+        }
+    }
+
+    bool Time::consume_fixed_step() {
+        if (!m_settings.fixed_timestep) return false;
+
+        const double fixed_delta = m_settings.fixed_delta;
+        if (m_accumulator < fixed_delta) return false;
+
+        // Drop the backlog once the cap is hit, keeping only the fraction of a step for interpolation.
+        if (m_fixed_steps >= m_settings.max_fixed_steps) {
+            m_accumulator = std::fmod(m_accumulator, fixed_delta);
+            return false;
+        }
+
+        m_accumulator -= fixed_delta;
+        ++m_fixed_steps;
+        return true;
     }
 
     float Time::get_delta() const { return m_delta; }
@@ -21,4 +55,12 @@ namespace vn {
     float Time::get_fps() const {
         return m_delta > 0.0f ? 1.0f / m_delta : 0.0f;
     }
-} // vn
\ No newline at end of file
+
+    bool Time::is_fixed_timestep() const { return m_settings.fixed_timestep; }
+    float Time::get_fixed_delta() const { return m_settings.fixed_delta; }
+
+    float Time::get_interpolation_alpha() const {
+        if (!m_settings.fixed_timestep) return 1.f;
+        return static_cast<float>(m_accumulator / m_settings.fixed_delta);
+    }
+} // vn
@@ -0,0 +1,41 @@
+#include "vinter/transform_batch.hpp"
+
+namespace vn {
+    std::size_t TransformBatch::add(const glm::vec2 position, const float rotation, const glm::vec2 scale) {
+        m_positions_x.push_back(position.x);
+        m_positions_y.push_back(position.y);
+        m_rotations.push_back(rotation);
+        m_scales_x.push_back(scale.x);
+        m_scales_y.push_back(scale.y);
+        return m_positions_x.size() - 1;
+    }
+
+    void TransformBatch::remove(const std::size_t index) {
+        for (std::vector<float>* component : { &m_positions_x, &m_positions_y, &m_rotations, &m_scales_x, &m_scales_y }) {
+            (*component)[index] = component->back();
+            component->pop_back();
+        }
+    }
+
+    void TransformBatch::reserve(const std::size_t count) {
+        for (std::vector<float>* component : { &m_positions_x, &m_positions_y, &m_rotations, &m_scales_x, &m_scales_y }) {
+            component->reserve(count);
+        }
+    }
+
+    void TransformBatch::clear() noexcept {
+        for (std::vector<float>* component : { &m_positions_x, &m_positions_y, &m_rotations, &m_scales_x, &m_scales_y }) {
+            component->clear();
+        }
+    }
+
+    void TransformBatch::set_position(const std::size_t index, const glm::vec2 position) {
+        m_positions_x[index] = position.x;
+        m_positions_y[index] = position.y;
+    }
+
+    void TransformBatch::set_scale(const std::size_t index, const glm::vec2 scale) {
+        m_scales_x[index] = scale.x;
+        m_scales_y[index] = scale.y;
+    }
+} // vn
@@ -1,5 +1,7 @@
 #include "vinter/window.hpp"
 
+#include <stdexcept>
+
 #include <SDL3/SDL.h>
 
 #include "vinter/settings/window_settings.hpp"
@@ -45,6 +47,10 @@ namespace vn {
 
     Window::Window(const WindowSettings &window_settings)
         : m_impl(std::make_unique<Impl>(window_settings)) {
+        if (!SDL_GetWindowSizeInPixels(m_impl->sdl_window_backend, &m_width, &m_height)) {
+            m_width  = window_settings.initial_size.width;
+            m_height = window_settings.initial_size.height;
+        }
     }
 
     Window::~Window() = default;
@@ -54,7 +60,8 @@ namespace vn {
     }
 
     void Window::handle_events(const SDL_Event& event) {
-        if (event.type == SDL_EVENT_WINDOW_RESIZED) {
+        // Unlike SDL_EVENT_WINDOW_RESIZED, reports the size in pixels, which differs on high density displays.
+        if (event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED) {
             m_width  = event.window.data1;
             m_height = event.window.data2;
         }